@@ -0,0 +1,67 @@
+#include "PlayerPerceptionEvaluator.h"
+#include "PlayerPerceptionSubsystem.h"
+#include "StateTreeExecutionContext.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+
+namespace
+{
+    UPlayerPerceptionSubsystem* GetPerception(const APawn* Pawn)
+    {
+        const UWorld* World = Pawn ? Pawn->GetWorld() : nullptr;
+        return World ? World->GetSubsystem<UPlayerPerceptionSubsystem>() : nullptr;
+    }
+}
+
+void FStateTreePlayerPerceptionEvaluator::TreeStart(FStateTreeExecutionContext& Context) const
+{
+    FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+    if (UPlayerPerceptionSubsystem* Perception = GetPerception(InstanceData.Pawn))
+        InstanceData.ObserverHandle = Perception->RegisterObserver(InstanceData.Pawn);
+}
+
+void FStateTreePlayerPerceptionEvaluator::TreeStop(FStateTreeExecutionContext& Context) const
+{
+    FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+    if (UPlayerPerceptionSubsystem* Perception = GetPerception(InstanceData.Pawn))
+        Perception->UnregisterObserver(InstanceData.ObserverHandle);
+
+    InstanceData.ObserverHandle = INDEX_NONE;
+}
+
+void FStateTreePlayerPerceptionEvaluator::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
+{
+    FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+    UPlayerPerceptionSubsystem* Perception = GetPerception(InstanceData.Pawn);
+    if (!Perception) return;
+
+    float Distance = 0.0f;
+    const FPerceivedPlayer* Player = Perception->GetNearestPlayer(InstanceData.ObserverHandle, Distance);
+
+    InstanceData.TargetPlayer          = Player ? Player->Pawn.Get() : nullptr;
+    InstanceData.TargetPlayerCharacter = Player ? Player->Character.Get() : nullptr;
+
+    if (Player)
+    {
+        InstanceData.TargetPlayerLocation  = Player->Location;
+        InstanceData.TargetPlayerVelocity  = Player->Velocity;
+        InstanceData.bTargetPlayerGrounded = Player->bGrounded;
+        InstanceData.DistanceToTarget      = Distance;
+    }
+    else
+    {
+        InstanceData.TargetPlayerVelocity  = FVector::ZeroVector;
+        InstanceData.bTargetPlayerGrounded = false;
+        InstanceData.DistanceToTarget      = FVector::Distance(InstanceData.TargetPlayerLocation, InstanceData.Pawn->GetActorLocation());
+    }
+}
+
+#if WITH_EDITOR
+FText FStateTreePlayerPerceptionEvaluator::GetDescription(const FGuid& ID, FStateTreeDataView InstanceDataView, const IStateTreeBindingLookup& BindingLookup, EStateTreeNodeFormatting Formatting) const
+{
+    return FText::FromString("<b>Player Perception</b>");
+}
+#endif
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StateTreeEvaluatorBase.h"
+#include "PlayerPerceptionEvaluator.generated.h"
+
+class APawn;
+class ACharacter;
+
+USTRUCT()
+struct SWINGGAME_API FStateTreePlayerPerceptionInstanceData
+{
+    GENERATED_BODY()
+
+    /** AI pawn the tree runs for */
+    UPROPERTY(EditAnywhere, Category = "Context")
+    TObjectPtr<APawn> Pawn;
+
+    /** Nearest player pawn this frame, null if there is none */
+    UPROPERTY(VisibleAnywhere, Category = "Output")
+    TObjectPtr<APawn> TargetPlayer;
+
+    /** TargetPlayer as an ACharacter, null if it isn't one */
+    UPROPERTY(VisibleAnywhere, Category = "Output")
+    TObjectPtr<ACharacter> TargetPlayerCharacter;
+
+    /** Last known location of the target — kept while there is no player */
+    UPROPERTY(VisibleAnywhere, Category = "Output")
+    FVector TargetPlayerLocation = FVector::ZeroVector;
+
+    UPROPERTY(VisibleAnywhere, Category = "Output")
+    FVector TargetPlayerVelocity = FVector::ZeroVector;
+
+    UPROPERTY(VisibleAnywhere, Category = "Output")
+    bool bTargetPlayerGrounded = false;
+
+    /** Distance from Pawn to TargetPlayerLocation (cm) */
+    UPROPERTY(VisibleAnywhere, Category = "Output")
+    float DistanceToTarget = 0.0f;
+
+    /** UPlayerPerceptionSubsystem observer handle */
+    int32 ObserverHandle = INDEX_NONE;
+};
+
+/**
+ * Global evaluator exposing the nearest player from UPlayerPerceptionSubsystem's
+ * per-frame snapshot. The pawn is registered as an observer while the tree runs,
+ * so its distance comes out of the subsystem's one batch per frame rather than a
+ * GetPlayerPawn lookup per agent. Bind tasks and conditions to its outputs.
+ */
+USTRUCT(meta = (DisplayName = "Player Perception", Category = "AI"))
+struct SWINGGAME_API FStateTreePlayerPerceptionEvaluator : public FStateTreeEvaluatorCommonBase
+{
+    GENERATED_BODY()
+
+    using FInstanceDataType = FStateTreePlayerPerceptionInstanceData;
+    virtual const UStruct* GetInstanceDataType() const override { return FInstanceDataType::StaticStruct(); }
+
+    virtual void TreeStart(FStateTreeExecutionContext& Context) const override;
+    virtual void TreeStop(FStateTreeExecutionContext& Context) const override;
+    virtual void Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const override;
+
+#if WITH_EDITOR
+    virtual FText GetDescription(const FGuid& ID, FStateTreeDataView InstanceDataView, const IStateTreeBindingLookup& BindingLookup, EStateTreeNodeFormatting Formatting = EStateTreeNodeFormatting::Text) const override;
+#endif
+};
@@ -0,0 +1,144 @@
+#include "PlayerPerceptionSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/PawnMovementComponent.h"
+#include "GameFramework/PlayerController.h"
+
+int32 UPlayerPerceptionSubsystem::RegisterObserver(APawn* InObserver)
+{
+    if (!InObserver) return INDEX_NONE;
+
+    int32 Handle;
+    if (FreeObserverSlots.Num() > 0)
+    {
+        Handle = FreeObserverSlots.Pop(EAllowShrinking::No);
+    }
+    else
+    {
+        Handle = ObserverPawns.AddDefaulted();
+        ObserverLocations.AddZeroed();
+        NearestPlayers.Add(INDEX_NONE);
+        NearestDistances.AddZeroed();
+    }
+
+    ObserverPawns[Handle] = InObserver;
+
+    // Registered after this frame's batch — resolve it on its own so it sees this frame too
+    if (SnapshotFrame == GFrameCounter)
+        ResolveObserver(Handle);
+
+    return Handle;
+}
+
+void UPlayerPerceptionSubsystem::UnregisterObserver(int32 Handle)
+{
+    if (!ObserverPawns.IsValidIndex(Handle) || ObserverPawns[Handle].IsExplicitlyNull()) return;
+
+    ObserverPawns[Handle].Reset();
+    NearestPlayers[Handle] = INDEX_NONE;
+    FreeObserverSlots.Add(Handle);
+}
+
+const FPerceivedPlayer* UPlayerPerceptionSubsystem::GetNearestPlayer(int32 Handle, float& OutDistance)
+{
+    Refresh();
+
+    if (!NearestPlayers.IsValidIndex(Handle) || NearestPlayers[Handle] == INDEX_NONE) return nullptr;
+
+    OutDistance = NearestDistances[Handle];
+    return &Players[NearestPlayers[Handle]];
+}
+
+void UPlayerPerceptionSubsystem::Deinitialize()
+{
+    Players.Empty();
+    ObserverPawns.Empty();
+    ObserverLocations.Empty();
+    NearestPlayers.Empty();
+    NearestDistances.Empty();
+    FreeObserverSlots.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UPlayerPerceptionSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UPlayerPerceptionSubsystem::Refresh()
+{
+    if (SnapshotFrame == GFrameCounter) return;
+    SnapshotFrame = GFrameCounter;
+
+    Players.Reset();
+    for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PlayerController = It->Get();
+        APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+        if (!Pawn) continue;
+
+        FPerceivedPlayer& Player = Players.AddDefaulted_GetRef();
+        Player.Pawn      = Pawn;
+        Player.Character = Cast<ACharacter>(Pawn);
+        Player.Location  = Pawn->GetActorLocation();
+        Player.Velocity  = Pawn->GetVelocity();
+
+        const UPawnMovementComponent* Movement = Pawn->GetMovementComponent();
+        Player.bGrounded = Movement && Movement->IsMovingOnGround();
+    }
+
+    // Gather observer locations first, then measure in flat loops over the arrays
+    const int32 NumObservers = ObserverPawns.Num();
+    for (int32 Handle = 0; Handle < NumObservers; ++Handle)
+    {
+        const APawn* Observer = ObserverPawns[Handle].Get();
+        ObserverLocations[Handle] = Observer ? Observer->GetActorLocation() : FVector::ZeroVector;
+        NearestPlayers[Handle]    = INDEX_NONE;
+        NearestDistances[Handle]  = TNumericLimits<float>::Max();
+    }
+
+    for (int32 PlayerIndex = 0; PlayerIndex < Players.Num(); ++PlayerIndex)
+    {
+        const FVector PlayerLocation = Players[PlayerIndex].Location;
+        for (int32 Handle = 0; Handle < NumObservers; ++Handle)
+        {
+            const float DistanceSquared = FVector::DistSquared(ObserverLocations[Handle], PlayerLocation);
+            if (DistanceSquared < NearestDistances[Handle])
+            {
+                NearestDistances[Handle] = DistanceSquared;
+                NearestPlayers[Handle]   = PlayerIndex;
+            }
+        }
+    }
+
+    for (int32 Handle = 0; Handle < NumObservers; ++Handle)
+    {
+        if (ObserverPawns[Handle].IsValid())
+            NearestDistances[Handle] = FMath::Sqrt(NearestDistances[Handle]);
+        else
+            NearestPlayers[Handle] = INDEX_NONE;
+    }
+}
+
+void UPlayerPerceptionSubsystem::ResolveObserver(int32 Handle)
+{
+    const APawn* Observer = ObserverPawns[Handle].Get();
+    NearestPlayers[Handle] = INDEX_NONE;
+    if (!Observer) return;
+
+    ObserverLocations[Handle] = Observer->GetActorLocation();
+
+    float NearestDistanceSquared = TNumericLimits<float>::Max();
+    for (int32 PlayerIndex = 0; PlayerIndex < Players.Num(); ++PlayerIndex)
+    {
+        const float DistanceSquared = FVector::DistSquared(ObserverLocations[Handle], Players[PlayerIndex].Location);
+        if (DistanceSquared < NearestDistanceSquared)
+        {
+            NearestDistanceSquared = DistanceSquared;
+            NearestPlayers[Handle] = PlayerIndex;
+        }
+    }
+
+    NearestDistances[Handle] = FMath::Sqrt(NearestDistanceSquared);
+}
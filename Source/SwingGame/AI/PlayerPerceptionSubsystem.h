@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PlayerPerceptionSubsystem.generated.h"
+
+class APawn;
+class ACharacter;
+
+/** One player pawn as seen by AI this frame */
+struct SWINGGAME_API FPerceivedPlayer
+{
+    TWeakObjectPtr<APawn>      Pawn;
+
+    /** Pawn already cast to ACharacter, null if it isn't one */
+    TWeakObjectPtr<ACharacter> Character;
+
+    FVector Location  = FVector::ZeroVector;
+    FVector Velocity  = FVector::ZeroVector;
+    bool    bGrounded = false;
+};
+
+/**
+ * Per-frame snapshot of the player pawns for AI.
+ *
+ * The first query of a frame gathers every player controller's pawn once —
+ * location, velocity, grounded state — and, in the same pass, the distance from
+ * every registered observer to its nearest player. AI reads the snapshot instead
+ * of each agent calling GetPlayerPawn, casting and measuring on its own.
+ * Shared by the AI of every variant; controllers without a pawn are skipped.
+ */
+UCLASS()
+class SWINGGAME_API UPlayerPerceptionSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Adds a pawn whose nearest player is resolved in the per-frame batch. Returns its handle */
+    int32 RegisterObserver(APawn* InObserver);
+    void  UnregisterObserver(int32 Handle);
+
+    /** Nearest player to a registered observer this frame, or null if there are no players */
+    const FPerceivedPlayer* GetNearestPlayer(int32 Handle, float& OutDistance);
+
+    virtual void Deinitialize() override;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    /** Rebuilds the snapshot on the first query of a frame */
+    void Refresh();
+
+    /** Resolves one observer's nearest player against the current snapshot */
+    void ResolveObserver(int32 Handle);
+
+    TArray<FPerceivedPlayer> Players;
+
+    /** Observers, one slot per handle. Freed slots hold a null pawn until reused */
+    TArray<TWeakObjectPtr<APawn>> ObserverPawns;
+    TArray<FVector>               ObserverLocations;
+    TArray<int32>                 NearestPlayers;
+    TArray<float>                 NearestDistances;
+    TArray<int32>                 FreeObserverSlots;
+
+    uint64 SnapshotFrame = TNumericLimits<uint64>::Max();
+};
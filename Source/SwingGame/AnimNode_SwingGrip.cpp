@@ -0,0 +1,71 @@
+#include "AnimNode_SwingGrip.h"
+#include "Animation/AnimInstanceProxy.h"
+#include "TwoBoneIK.h"
+
+FAnimNode_SwingGrip::FAnimNode_SwingGrip()
+{
+    FSwingGripLimb LeftLeg;
+    LeftLeg.EffectorBone = FBoneReference(TEXT("LegFL3"));
+    LeftLeg.GripOffset   = FVector(0.0f, -15.0f, 0.0f);
+
+    FSwingGripLimb RightLeg;
+    RightLeg.EffectorBone = FBoneReference(TEXT("LegFR3"));
+    RightLeg.GripOffset   = FVector(0.0f, 15.0f, 0.0f);
+
+    Limbs = { LeftLeg, RightLeg };
+}
+
+void FAnimNode_SwingGrip::InitializeBoneReferences(const FBoneContainer& RequiredBones)
+{
+    for (FSwingGripLimb& Limb : Limbs)
+    {
+        Limb.EffectorBone.Initialize(RequiredBones);
+
+        Limb.EffectorIndex = Limb.EffectorBone.GetCompactPoseIndex(RequiredBones);
+        Limb.JointIndex    = Limb.EffectorIndex.IsValid()
+            ? RequiredBones.GetParentBoneIndex(Limb.EffectorIndex) : FCompactPoseBoneIndex(INDEX_NONE);
+        Limb.RootIndex     = Limb.JointIndex.IsValid()
+            ? RequiredBones.GetParentBoneIndex(Limb.JointIndex) : FCompactPoseBoneIndex(INDEX_NONE);
+    }
+}
+
+bool FAnimNode_SwingGrip::IsValidToEvaluate(const USkeleton* Skeleton, const FBoneContainer& RequiredBones)
+{
+    for (const FSwingGripLimb& Limb : Limbs)
+    {
+        if (!Limb.RootIndex.IsValid()) return false;
+    }
+    return !Limbs.IsEmpty();
+}
+
+void FAnimNode_SwingGrip::EvaluateSkeletalControl_AnyThread(
+    FComponentSpacePoseContext& Output, TArray<FBoneTransform>& OutBoneTransforms)
+{
+    const FTransform& ComponentTransform = Output.AnimInstanceProxy->GetComponentTransform();
+
+    // Grip offsets are authored along the pole, whichever way it faces
+    const FQuat PoleRotation = Snapshot.PoleDirection.IsNearlyZero()
+        ? FQuat::Identity
+        : FRotationMatrix::MakeFromYZ(Snapshot.PoleDirection, FVector::UpVector).ToQuat();
+
+    for (const FSwingGripLimb& Limb : Limbs)
+    {
+        FTransform Root     = Output.Pose.GetComponentSpaceTransform(Limb.RootIndex);
+        FTransform Joint    = Output.Pose.GetComponentSpaceTransform(Limb.JointIndex);
+        FTransform Effector = Output.Pose.GetComponentSpaceTransform(Limb.EffectorIndex);
+
+        const FVector Grip = ComponentTransform.InverseTransformPosition(Snapshot.PivotLocation + PoleRotation.RotateVector(Limb.GripOffset));
+
+        // Bend toward wherever the animated joint already points
+        AnimationCore::SolveTwoBoneIK(
+            Root, Joint, Effector, Joint.GetLocation(), Grip,
+            bAllowStretching, 1.0f, MaxStretchScale);
+
+        OutBoneTransforms.Add(FBoneTransform(Limb.RootIndex, Root));
+        OutBoneTransforms.Add(FBoneTransform(Limb.JointIndex, Joint));
+        OutBoneTransforms.Add(FBoneTransform(Limb.EffectorIndex, Effector));
+    }
+
+    // Limbs are independent chains, but the blend expects bones in pose order
+    OutBoneTransforms.Sort(FCompareBoneTransformIndex());
+}
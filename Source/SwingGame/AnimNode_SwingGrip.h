@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BoneContainer.h"
+#include "BoneControllers/AnimNode_SkeletalControlBase.h"
+#include "SwingComponent.h"
+#include "AnimNode_SwingGrip.generated.h"
+
+/** One limb gripping the pole: a two-bone chain ending at EffectorBone */
+USTRUCT(BlueprintInternalUseOnly)
+struct SWINGGAME_API FSwingGripLimb
+{
+    GENERATED_BODY()
+
+    /** Hand or paw — its parent is the joint (elbow/knee), the grandparent the chain root */
+    UPROPERTY(EditAnywhere, Category = "Grip")
+    FBoneReference EffectorBone;
+
+    /** Grip point relative to the swing pivot in the pole's frame (cm): Y along the pole, Z up */
+    UPROPERTY(EditAnywhere, Category = "Grip")
+    FVector GripOffset = FVector::ZeroVector;
+
+    /** Chain resolved once per bone container change */
+    FCompactPoseBoneIndex RootIndex     = FCompactPoseBoneIndex(INDEX_NONE);
+    FCompactPoseBoneIndex JointIndex    = FCompactPoseBoneIndex(INDEX_NONE);
+    FCompactPoseBoneIndex EffectorIndex = FCompactPoseBoneIndex(INDEX_NONE);
+};
+
+/**
+ * Places every gripping limb on the swing pivot in one pass.
+ * Replaces a Two-Bone IK node per hand fed through Blueprint: bind Snapshot to
+ * USwingAnimInstance::Snapshot and Alpha to IKAlpha (both plain member reads,
+ * so the graph stays on the fast path). Runs on the animation worker thread.
+ *
+ * Defaults fit the Fab wolf skeleton: the forelegs LegFL3 / LegFR3 as effectors,
+ * spread along the pole. For the UE mannequin use hand_l / hand_r.
+ */
+USTRUCT(BlueprintInternalUseOnly)
+struct SWINGGAME_API FAnimNode_SwingGrip : public FAnimNode_SkeletalControlBase
+{
+    GENERATED_BODY()
+
+    FAnimNode_SwingGrip();
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Swing", meta = (PinShownByDefault))
+    FSwingAnimSnapshot Snapshot;
+
+    UPROPERTY(EditAnywhere, Category = "Swing")
+    TArray<FSwingGripLimb> Limbs;
+
+    /** Let arms stretch up to MaxStretchScale when the pivot is out of reach */
+    UPROPERTY(EditAnywhere, Category = "Swing")
+    bool bAllowStretching = false;
+
+    UPROPERTY(EditAnywhere, Category = "Swing", meta = (ClampMin = 1, EditCondition = "bAllowStretching"))
+    float MaxStretchScale = 1.2f;
+
+    virtual void EvaluateSkeletalControl_AnyThread(
+        FComponentSpacePoseContext& Output, TArray<FBoneTransform>& OutBoneTransforms) override;
+    virtual bool IsValidToEvaluate(const USkeleton* Skeleton, const FBoneContainer& RequiredBones) override;
+
+private:
+    virtual void InitializeBoneReferences(const FBoneContainer& RequiredBones) override;
+};
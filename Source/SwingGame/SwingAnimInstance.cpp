@@ -2,22 +2,31 @@
 #include "SwingComponent.h"
 #include "GameFramework/Character.h"
 
+void USwingAnimInstance::NativeInitializeAnimation()
+{
+    Super::NativeInitializeAnimation();
+
+    if (ACharacter* Owner = Cast<ACharacter>(TryGetPawnOwner()))
+        SwingComp = Owner->FindComponentByClass<USwingComponent>();
+}
+
 void USwingAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
 {
     Super::NativeUpdateAnimation(DeltaSeconds);
 
-    if (!SwingComp)
-    {
-        if (ACharacter* Owner = Cast<ACharacter>(TryGetPawnOwner()))
-            SwingComp = Owner->FindComponentByClass<USwingComponent>();
-    }
-    if (!SwingComp) return;
+    // The only game-thread work: one copy of what the component published this tick
+    if (SwingComp) Snapshot = SwingComp->GetAnimSnapshot();
+}
+
+void USwingAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+    Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
 
-    SwingState           = SwingComp->SwingState;
-    SwingAngle           = SwingComp->SwingAngle;
-    SwingAngularVelocity = SwingComp->SwingAngularVelocity;
-    PivotLocation        = SwingComp->PivotWorldLocation;
-    bIsSwinging          = SwingComp->bIsSwinging;
+    SwingState           = Snapshot.SwingState;
+    SwingAngle           = Snapshot.SwingAngle;
+    SwingAngularVelocity = Snapshot.SwingAngularVelocity;
+    PivotLocation        = Snapshot.PivotLocation;
+    bIsSwinging          = Snapshot.bIsSwinging;
 
     // Smooth IK weight: fast on, slower off
     const float TargetAlpha = bIsSwinging ? 1.0f : 0.0f;
@@ -14,6 +14,10 @@
  *  - SwingAngle   → BlendSpace 1D input for SwingLoop
  *  - PivotLocation → Two-Bone IK effector target for both hands
  *  - IKAlpha      → Two-Bone IK blend weight
+ *  - Snapshot + IKAlpha → Swing Grip node (both hands in one native node)
+ *
+ * The game thread only copies USwingComponent's anim snapshot; everything
+ * else runs in NativeThreadSafeUpdateAnimation on the animation worker threads.
  */
 UCLASS()
 class SWINGGAME_API USwingAnimInstance : public UAnimInstance
@@ -21,7 +25,9 @@ class SWINGGAME_API USwingAnimInstance : public UAnimInstance
     GENERATED_BODY()
 
 public:
+    virtual void NativeInitializeAnimation() override;
     virtual void NativeUpdateAnimation(float DeltaSeconds) override;
+    virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
 
     UPROPERTY(BlueprintReadOnly, Category = "Swing")
     bool bIsSwinging = false;
@@ -44,6 +50,10 @@ public:
     UPROPERTY(BlueprintReadOnly, Category = "Swing")
     float IKAlpha = 0.0f;
 
+    /** Copied from the swing component on the game thread. Bind to the Swing Grip node. */
+    UPROPERTY(BlueprintReadOnly, Category = "Swing")
+    FSwingAnimSnapshot Snapshot;
+
 private:
     UPROPERTY()
     class USwingComponent* SwingComp = nullptr;
@@ -0,0 +1,405 @@
+#include "SwingBenchmarkSubsystem.h"
+#include "SwingComponent.h"
+#include "SwingGame.h"
+#include "SwingGameCharacter.h"
+#include "SwingPendulumKernel.h"
+#include "SwingPole.h"
+#include "SwingPoleField.h"
+#include "SwingStats.h"
+#include "Components/BoxComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "RenderCore.h"
+
+static TAutoConsoleVariable<FString> CVarSwingBenchmarkSwingerClass(
+    TEXT("Swing.Benchmark.SwingerClass"),
+    TEXT("/Game/ThirdPerson/Blueprints/BP_ThirdPersonCharacter.BP_ThirdPersonCharacter_C"),
+    TEXT("ASwingGameCharacter subclass spawned as benchmark swinger"));
+
+static FAutoConsoleCommandWithWorldAndArgs GSwingBenchmark(
+    TEXT("Swing.Benchmark"),
+    TEXT("Swing.Benchmark <Swingers> <Poles> <Seconds> [field] [lod] [exit] — swing stress test, results in Saved/SwingBenchmark"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        USwingBenchmarkSubsystem* Benchmark = World ? World->GetSubsystem<USwingBenchmarkSubsystem>() : nullptr;
+        if (!Benchmark || Args.Num() < 3)
+        {
+            UE_LOG(LogSwingGame, Warning, TEXT("Usage: Swing.Benchmark <Swingers> <Poles> <Seconds> [field] [lod] [exit]"));
+            return;
+        }
+
+        Benchmark->Start(
+            FCString::Atoi(*Args[0]), FCString::Atoi(*Args[1]), FCString::Atof(*Args[2]),
+            Args.Contains(TEXT("field")), Args.Contains(TEXT("lod")), Args.Contains(TEXT("exit")));
+    }));
+
+namespace
+{
+    /** Pendulum SoA filled with the default swing tuning, spread over the swing range */
+    struct FKernelBenchmarkSet
+    {
+        TArray<float> Angles, AngularVelocities, HangLengths, AutoSwingForces, Dampings, DampingLog2s, MinAngles, MaxAngles;
+        TArray<float> Restitutions, DeltaTimes;
+
+        FKernelBenchmarkSet(int32 Count, float DeltaTime)
+        {
+            for (int32 Index = 0; Index < Count; ++Index)
+            {
+                const float Phase = Count > 1 ? float(Index) / float(Count - 1) : 0.5f;
+                Angles.Add(FMath::Lerp(-1.5f, 1.5f, Phase));
+                AngularVelocities.Add(FMath::Lerp(2.0f, -2.0f, Phase));
+                HangLengths.Add(FMath::Lerp(120.0f, 220.0f, Phase));
+                AutoSwingForces.Add(1.5f);
+                Dampings.Add(0.995f);
+                DampingLog2s.Add(FSwingPendulumKernel::GetDampingLog2(0.995f));
+                MinAngles.Add(-2.2f);
+                MaxAngles.Add(2.2f);
+                Restitutions.Add(0.0f);
+                DeltaTimes.Add(DeltaTime);
+            }
+        }
+    };
+
+    /** Runs Body until about TargetSteps pendulum steps are done, returns ns per pendulum step */
+    template <typename TBody>
+    double TimeKernel(int32 Count, TBody&& Body)
+    {
+        constexpr int64 TargetSteps = 4 * 1024 * 1024;
+        const int64 Iterations = FMath::Max<int64>(TargetSteps / Count, 1);
+
+        const double Start = FPlatformTime::Seconds();
+        for (int64 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            Body();
+        }
+        return (FPlatformTime::Seconds() - Start) * 1.0e9 / double(Iterations * Count);
+    }
+
+    void RunKernelBenchmark()
+    {
+        constexpr float DeltaTime = 1.0f / 60.0f;
+
+        UE_LOG(LogSwingGame, Log, TEXT("Pendulum kernel benchmark — batch path %hs"),
+            FSwingPendulumKernel::GetBatchPathName());
+
+        for (const int32 Count : { 1, 64, 4096 })
+        {
+            FKernelBenchmarkSet Exact(Count, DeltaTime), Scalar(Count, DeltaTime), Batch(Count, DeltaTime);
+
+            const double ExactNs = TimeKernel(Count, [&Exact, Count]()
+            {
+                for (int32 Index = 0; Index < Count; ++Index)
+                {
+                    FSwingPendulumKernel::Step(
+                        Exact.Angles[Index], Exact.AngularVelocities[Index],
+                        Exact.HangLengths[Index], Exact.AutoSwingForces[Index], Exact.Dampings[Index],
+                        Exact.MinAngles[Index], Exact.MaxAngles[Index], DeltaTime);
+                }
+            });
+            const double ScalarNs = TimeKernel(Count, [&Scalar, Count]()
+            {
+                FSwingPendulumKernel::StepBatchScalar(
+                    Scalar.Angles.GetData(), Scalar.AngularVelocities.GetData(),
+                    Scalar.HangLengths.GetData(), Scalar.AutoSwingForces.GetData(), Scalar.DampingLog2s.GetData(),
+                    Scalar.MinAngles.GetData(), Scalar.MaxAngles.GetData(),
+                    Scalar.Restitutions.GetData(), Scalar.Restitutions.GetData(), Scalar.DeltaTimes.GetData(), Count);
+            });
+            const double BatchNs = TimeKernel(Count, [&Batch, Count]()
+            {
+                FSwingPendulumKernel::StepBatch(
+                    Batch.Angles.GetData(), Batch.AngularVelocities.GetData(),
+                    Batch.HangLengths.GetData(), Batch.AutoSwingForces.GetData(), Batch.DampingLog2s.GetData(),
+                    Batch.MinAngles.GetData(), Batch.MaxAngles.GetData(),
+                    Batch.Restitutions.GetData(), Batch.Restitutions.GetData(), Batch.DeltaTimes.GetData(), Count);
+            });
+
+            // One step from identical state — the batched paths approximate sin and pow
+            FKernelBenchmarkSet Reference(Count, DeltaTime), Approximate(Count, DeltaTime);
+            for (int32 Index = 0; Index < Count; ++Index)
+            {
+                FSwingPendulumKernel::Step(
+                    Reference.Angles[Index], Reference.AngularVelocities[Index],
+                    Reference.HangLengths[Index], Reference.AutoSwingForces[Index], Reference.Dampings[Index],
+                    Reference.MinAngles[Index], Reference.MaxAngles[Index], DeltaTime);
+            }
+            FSwingPendulumKernel::StepBatch(
+                Approximate.Angles.GetData(), Approximate.AngularVelocities.GetData(),
+                Approximate.HangLengths.GetData(), Approximate.AutoSwingForces.GetData(), Approximate.DampingLog2s.GetData(),
+                Approximate.MinAngles.GetData(), Approximate.MaxAngles.GetData(),
+                Approximate.Restitutions.GetData(), Approximate.Restitutions.GetData(), Approximate.DeltaTimes.GetData(), Count);
+
+            float MaxError = 0.0f;
+            for (int32 Index = 0; Index < Count; ++Index)
+            {
+                MaxError = FMath::Max(MaxError, FMath::Abs(Reference.AngularVelocities[Index] - Approximate.AngularVelocities[Index]));
+            }
+
+            UE_LOG(LogSwingGame, Log,
+                TEXT("  %5d pendulums: Step %.2f ns, StepBatchScalar %.2f ns, StepBatch %.2f ns per step (max |dω| %.2e rad/s)"),
+                Count, ExactNs, ScalarNs, BatchNs, MaxError);
+        }
+    }
+}
+
+static FAutoConsoleCommand GSwingKernelBenchmark(
+    TEXT("Swing.KernelBenchmark"),
+    TEXT("Swing.KernelBenchmark — ns per pendulum step of the scalar and batched kernels for 1, 64 and 4096 pendulums"),
+    FConsoleCommandDelegate::CreateStatic(&RunKernelBenchmark));
+
+bool USwingBenchmarkSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId USwingBenchmarkSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USwingBenchmarkSubsystem, STATGROUP_Tickables);
+}
+
+// ---------------------------------------------------------------------------
+// Setup
+// ---------------------------------------------------------------------------
+
+void USwingBenchmarkSubsystem::Start(
+    int32 NumSwingers, int32 NumPoles, float Duration, bool bUsePoleField, bool bInSwingLOD, bool bInExitWhenDone)
+{
+    if (bRunning || NumSwingers <= 0 || NumPoles <= 0 || Duration <= 0.0f) return;
+
+    Label = FString::Printf(TEXT("Swing_%d_%d_%s%s_%s"),
+        NumSwingers, NumPoles, bUsePoleField ? TEXT("Field") : TEXT("Actors"), bInSwingLOD ? TEXT("_LOD") : TEXT(""),
+        *FDateTime::Now().ToString());
+
+    SpawnCourse(NumPoles, bUsePoleField);
+    SpawnSwingers(NumSwingers, bInSwingLOD);
+
+    bExitWhenDone = bInExitWhenDone;
+    if (Swingers.IsEmpty())
+    {
+        Finish();
+        return;
+    }
+
+    Frames.Reset();
+    Frames.Reserve(FMath::CeilToInt(Duration * 120.0f));
+
+    LastSceneQueries     = FSwingStats::SceneQueries;
+    LastTransformUpdates = FSwingStats::TransformUpdates;
+    LastFrameTime        = FPlatformTime::Seconds();
+    EndTime              = LastFrameTime + Duration;
+    bRunning             = true;
+
+    UE_LOG(LogSwingGame, Log, TEXT("Swing benchmark %s started for %.0f s"), *Label, Duration);
+}
+
+void USwingBenchmarkSubsystem::SpawnCourse(int32 NumPoles, bool bUsePoleField)
+{
+    UWorld* World = GetWorld();
+
+    const int32 Side = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumPoles)));
+    PoleLocations.Reset(NumPoles);
+    for (int32 Index = 0; Index < NumPoles; ++Index)
+    {
+        PoleLocations.Add(FVector(
+            (Index % Side) * PoleSpacing, (Index / Side) * PoleSpacing, CourseZ + PoleHeight));
+    }
+
+    // Floor under the whole grid
+    const float HalfExtent = 0.5f * Side * PoleSpacing + PoleSpacing;
+    AActor* Floor = World->SpawnActor<AActor>();
+    UBoxComponent* FloorBox = NewObject<UBoxComponent>(Floor);
+    FloorBox->SetBoxExtent(FVector(HalfExtent, HalfExtent, 50.0f));
+    FloorBox->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+    Floor->SetRootComponent(FloorBox);
+    FloorBox->RegisterComponent();
+    FloorBox->SetWorldLocation(FVector(HalfExtent - PoleSpacing, HalfExtent - PoleSpacing, CourseZ - 50.0f));
+    SpawnedActors.Add(Floor);
+
+    if (bUsePoleField)
+    {
+        ASwingPoleField* Field = World->SpawnActor<ASwingPoleField>(FVector::ZeroVector, FRotator::ZeroRotator);
+        for (const FVector& Location : PoleLocations)
+        {
+            FSwingPoleFieldEntry& Entry = Field->Poles.AddDefaulted_GetRef();
+            Entry.Transform.SetLocation(Location);
+        }
+        Field->RebuildInstances();
+        SpawnedActors.Add(Field);
+        return;
+    }
+
+    for (const FVector& Location : PoleLocations)
+    {
+        SpawnedActors.Add(World->SpawnActor<ASwingPole>(Location, FRotator::ZeroRotator));
+    }
+}
+
+void USwingBenchmarkSubsystem::SpawnSwingers(int32 NumSwingers, bool bSwingLOD)
+{
+    // ASwingGameCharacter is abstract — spawn the configured Blueprint child
+    UClass* SwingerClass = LoadClass<ASwingGameCharacter>(
+        nullptr, *CVarSwingBenchmarkSwingerClass.GetValueOnGameThread());
+    if (!SwingerClass)
+    {
+        UE_LOG(LogSwingGame, Warning, TEXT("Swing benchmark: swinger class %s not found"),
+            *CVarSwingBenchmarkSwingerClass.GetValueOnGameThread());
+        return;
+    }
+
+    FActorSpawnParameters Params;
+    Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    Swingers.Reset(NumSwingers);
+    for (int32 Index = 0; Index < NumSwingers; ++Index)
+    {
+        // Up to three swingers share a pole, spread along it
+        const FVector Pole   = PoleLocations[Index % PoleLocations.Num()];
+        const float   Spread = ((Index / PoleLocations.Num()) % 3 - 1) * 100.0f;
+        const FVector Home(Pole.X, Pole.Y + Spread, CourseZ + 100.0f);
+
+        ASwingGameCharacter* Character =
+            GetWorld()->SpawnActor<ASwingGameCharacter>(SwingerClass, Home, FRotator::ZeroRotator, Params);
+        if (!Character) continue;
+
+        // No controller — let the CMC simulate anyway
+        Character->GetCharacterMovement()->bRunPhysicsWithNoController = true;
+
+        FSwinger& Swinger = Swingers.AddDefaulted_GetRef();
+        Swinger.Character = Character;
+        Swinger.Swing     = Character->FindComponentByClass<USwingComponent>();
+        Swinger.Home      = Home;
+
+        // Nobody watches the course far below the level — without this every swinger runs the LOD closed form
+        if (Swinger.Swing.IsValid()) Swinger.Swing->bEnableSwingLOD = bSwingLOD;
+        SpawnedActors.Add(Character);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Run
+// ---------------------------------------------------------------------------
+
+void USwingBenchmarkSubsystem::Tick(float DeltaTime)
+{
+    if (!bRunning) return;
+
+    const double Now = FPlatformTime::Seconds();
+
+    int32 NumSwinging = 0;
+    for (FSwinger& Swinger : Swingers)
+    {
+        DriveSwinger(Swinger, DeltaTime);
+        if (Swinger.Swing.IsValid() && Swinger.Swing->SwingState == ESwingState::Swinging) ++NumSwinging;
+    }
+
+    // Game thread time of the last finished frame, excluding waits on other threads
+    FFrameSample& Frame = Frames.AddDefaulted_GetRef();
+    Frame.GameThreadMs     = FPlatformTime::ToMilliseconds(GGameThreadTime);
+    Frame.FrameMs          = (Now - LastFrameTime) * 1000.0;
+    Frame.SceneQueries     = FSwingStats::SceneQueries - LastSceneQueries;
+    Frame.TransformUpdates = FSwingStats::TransformUpdates - LastTransformUpdates;
+    Frame.NumSwinging      = NumSwinging;
+    Frame.UsedMemoryMB     = FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0);
+
+    LastFrameTime        = Now;
+    LastSceneQueries     = FSwingStats::SceneQueries;
+    LastTransformUpdates = FSwingStats::TransformUpdates;
+
+    if (Now >= EndTime) Finish();
+}
+
+void USwingBenchmarkSubsystem::DriveSwinger(FSwinger& Swinger, float DeltaTime)
+{
+    ACharacter*      Character = Swinger.Character.Get();
+    USwingComponent* Swing     = Swinger.Swing.Get();
+    if (!Character || !Swing) return;
+
+    UCharacterMovementComponent* CMC = Character->GetCharacterMovement();
+
+    if (Swing->SwingState == ESwingState::Swinging)
+    {
+        Swinger.SwingTime += DeltaTime;
+        if (Swinger.SwingTime >= SwingSeconds)
+        {
+            Swing->OnJumpPressed();  // release
+            Swinger.SwingTime = 0.0f;
+        }
+        return;
+    }
+
+    if (Swing->SwingState != ESwingState::None) return;
+
+    if (CMC->IsMovingOnGround())
+    {
+        // Back under the home pole after a launch, then jump at it
+        if (FVector::DistSquared2D(Character->GetActorLocation(), Swinger.Home) > FMath::Square(50.0f))
+            Character->SetActorLocation(Swinger.Home, false, nullptr, ETeleportType::TeleportPhysics);
+
+        Character->LaunchCharacter(FVector(0.0f, 0.0f, 700.0f), false, true);
+        Swinger.bGrabAttempted = false;
+    }
+    else if (!Swinger.bGrabAttempted && CMC->Velocity.Z < 0.0f)
+    {
+        Swing->OnJumpPressed();  // grab, or buffer the grab
+        Swinger.bGrabAttempted = true;
+    }
+}
+
+void USwingBenchmarkSubsystem::Finish()
+{
+    bRunning = false;
+
+    FString Csv = TEXT("Frame,GameThreadMs,FrameMs,SceneQueries,TransformUpdates,Swinging,UsedMemoryMB\n");
+    TArray<double> GameThreadTimes, FrameTimes;
+    GameThreadTimes.Reserve(Frames.Num());
+    FrameTimes.Reserve(Frames.Num());
+    int64 TotalQueries = 0, TotalTransforms = 0;
+
+    for (int32 Index = 0; Index < Frames.Num(); ++Index)
+    {
+        const FFrameSample& Frame = Frames[Index];
+        Csv += FString::Printf(TEXT("%d,%.3f,%.3f,%lld,%lld,%d,%.1f\n"),
+            Index, Frame.GameThreadMs, Frame.FrameMs, Frame.SceneQueries, Frame.TransformUpdates,
+            Frame.NumSwinging, Frame.UsedMemoryMB);
+
+        GameThreadTimes.Add(Frame.GameThreadMs);
+        FrameTimes.Add(Frame.FrameMs);
+        TotalQueries    += Frame.SceneQueries;
+        TotalTransforms += Frame.TransformUpdates;
+    }
+
+    const FString Filename = FPaths::ProjectSavedDir() / TEXT("SwingBenchmark") / (Label + TEXT(".csv"));
+    FFileHelper::SaveStringToFile(Csv, *Filename);
+
+    if (!FrameTimes.IsEmpty())
+    {
+        const int32 NumFrames = FrameTimes.Num();
+        const int32 P95       = FMath::Min(NumFrames - 1, NumFrames * 95 / 100);
+
+        GameThreadTimes.Sort();
+        FrameTimes.Sort();
+        double GameThreadSum = 0.0, FrameSum = 0.0;
+        for (const double Time : GameThreadTimes) GameThreadSum += Time;
+        for (const double Time : FrameTimes) FrameSum += Time;
+
+        UE_LOG(LogSwingGame, Log,
+            TEXT("Swing benchmark %s: %d frames, game thread avg %.3f ms, p95 %.3f ms, frame avg %.3f ms, p95 %.3f ms, %.1f queries/frame, %.1f transforms/frame -> %s"),
+            *Label, NumFrames, GameThreadSum / NumFrames, GameThreadTimes[P95], FrameSum / NumFrames, FrameTimes[P95],
+            double(TotalQueries) / NumFrames, double(TotalTransforms) / NumFrames, *Filename);
+    }
+
+    for (AActor* Actor : SpawnedActors)
+    {
+        if (IsValid(Actor)) Actor->Destroy();
+    }
+    SpawnedActors.Reset();
+    Swingers.Reset();
+    PoleLocations.Reset();
+
+    if (bExitWhenDone) FPlatformMisc::RequestExit(false);
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SwingBenchmarkSubsystem.generated.h"
+
+class ACharacter;
+class USwingComponent;
+
+/**
+ * Swing stress benchmark, started with
+ *   Swing.Benchmark <Swingers> <Poles> <Seconds> [field] [lod] [exit]
+ * Spawns a floor, a grid of poles (ASwingPole actors, or one ASwingPoleField
+ * with "field") and swingers (Swing.Benchmark.SwingerClass) far below the level, then
+ * drives jump / grab / release cycles for every swinger without player input.
+ * Swingers are fully simulated unless "lod" lets them drop to swing LOD.
+ * Each frame's game thread time (as in stat unit), wall time, swing scene queries,
+ * swing transform updates and process memory go to a CSV in Saved/SwingBenchmark.
+ * Works under -nullrhi; "exit" quits when done, for unattended runs:
+ *   UnrealEditor-Cmd SwingGame <Map> -game -nullrhi -ExecCmds="Swing.Benchmark 500 1000 60 exit"
+ */
+UCLASS()
+class SWINGGAME_API USwingBenchmarkSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    void Start(int32 NumSwingers, int32 NumPoles, float Duration, bool bUsePoleField, bool bInSwingLOD, bool bInExitWhenDone);
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    struct FSwinger
+    {
+        TWeakObjectPtr<ACharacter>      Character;
+        TWeakObjectPtr<USwingComponent> Swing;
+        FVector Home           = FVector::ZeroVector;
+        float   SwingTime      = 0.0f;
+        bool    bGrabAttempted = false;
+    };
+
+    struct FFrameSample
+    {
+        double GameThreadMs;
+        double FrameMs;
+        int64  SceneQueries;
+        int64  TransformUpdates;
+        int32  NumSwinging;
+        double UsedMemoryMB;
+    };
+
+    void SpawnCourse(int32 NumPoles, bool bUsePoleField);
+    void SpawnSwingers(int32 NumSwingers, bool bSwingLOD);
+    void DriveSwinger(FSwinger& Swinger, float DeltaTime);
+    void Finish();
+
+    /** Where the course is built — well below any level content */
+    static constexpr float CourseZ      = -50000.0f;
+    static constexpr float PoleSpacing  = 600.0f;
+    static constexpr float PoleHeight   = 400.0f;
+    static constexpr float SwingSeconds = 1.5f;
+
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<AActor>> SpawnedActors;
+
+    TArray<FVector>      PoleLocations;
+    TArray<FSwinger>     Swingers;
+    TArray<FFrameSample> Frames;
+
+    FString Label;
+    double  LastFrameTime = 0.0;
+    double  EndTime       = 0.0;
+    int64   LastSceneQueries     = 0;
+    int64   LastTransformUpdates = 0;
+    bool    bRunning      = false;
+    bool    bExitWhenDone = false;
+};
@@ -1,17 +1,36 @@
 #include "SwingComponent.h"
+#include "SwingPoleSubsystem.h"
+#include "SwingSimulationSubsystem.h"
+#include "SwingMovementComponent.h"
+#include "SwingPhysicsSubsystem.h"
+#include "SwingPendulumKernel.h"
 #include "SwingPole.h"
+#include "SwingPoleField.h"
+#include "SwingStats.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
 #include "Engine/World.h"
+#include "TimerManager.h"
 #include "Engine/EngineTypes.h"
-#include "Engine/OverlapResult.h"
-#include "CollisionShape.h"
-#include "WorldCollision.h"
 #include "CollisionQueryParams.h"
+#include "GameFramework/GameStateBase.h"
+#include "Net/UnrealNetwork.h"
+#include "SwingGame.h"
+
+static TAutoConsoleVariable<bool> CVarSwingNetLogCorrections(
+    TEXT("Swing.Net.LogCorrections"),
+    false,
+    TEXT("Log every server correction of the locally predicted swing."));
 
 USwingComponent::USwingComponent()
 {
     PrimaryComponentTick.bCanEverTick = true;
+
+    SetIsReplicatedByDefault(true);
 }
 
 // ---------------------------------------------------------------------------
@@ -56,6 +75,39 @@ void USwingComponent::TickComponent(
     }
 
     bIsSwinging = (SwingState != ESwingState::None);
+
+    FinishSwingUpdate(DeltaTime);
+}
+
+void USwingComponent::PublishAnimSnapshot()
+{
+    AnimSnapshot.SwingState           = SwingState;
+    AnimSnapshot.bIsSwinging          = bIsSwinging;
+    AnimSnapshot.SwingAngle           = SwingAngle;
+    AnimSnapshot.SwingAngularVelocity = SwingAngularVelocity;
+    AnimSnapshot.PivotLocation        = PivotWorldLocation;
+    AnimSnapshot.PoleDirection        = CurrentPoleDirection;
+}
+
+void USwingComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    OwnerCharacter = Cast<ACharacter>(GetOwner());
+
+    Recorder.Init(bRecordSwing ? SwingRecordCapacity : 0);
+
+    // Slope lean is layered on whatever the mesh is authored with
+    if (OwnerCharacter && OwnerCharacter->GetMesh())
+        BaseMeshRotation = OwnerCharacter->GetMesh()->GetRelativeRotation().Quaternion();
+}
+
+void USwingComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    GetWorld()->GetTimerManager().ClearTimer(GrabBufferTimer);
+    EndSwinging();
+
+    Super::EndPlay(EndPlayReason);
 }
 
 // ---------------------------------------------------------------------------
@@ -64,6 +116,8 @@ void USwingComponent::TickComponent(
 
 void USwingComponent::OnJumpPressed()
 {
+    bJumpSinceLastSample = true;
+
     if (SwingState == ESwingState::None)
         TryGrab();
     else if (SwingState == ESwingState::Swinging)
@@ -88,51 +142,99 @@ void USwingComponent::TryGrab()
     UCharacterMovementComponent* CMC = OwnerCharacter->GetCharacterMovement();
     if (CMC && CMC->IsMovingOnGround()) return;
 
-    const FVector Origin = OwnerCharacter->GetActorLocation();
+    if (!GrabNearestPole())
+        BufferGrab();
+}
 
-    TArray<FOverlapResult> Overlaps;
-    FCollisionShape        Sphere = FCollisionShape::MakeSphere(GrabDetectionRadius);
-    FCollisionQueryParams  Params(FName(TEXT("SwingGrab")), false, OwnerCharacter);
+bool USwingComponent::GrabNearestPole()
+{
+    USwingPoleSubsystem* Poles = GetWorld()->GetSubsystem<USwingPoleSubsystem>();
+    if (!Poles) return false;
 
-    GetWorld()->OverlapMultiByChannel(
-        Overlaps, Origin, FQuat::Identity,
-        ECC_WorldDynamic, Sphere, Params);
+    const FSwingPoleSegment* Segment =
+        Poles->FindNearestSegment(OwnerCharacter->GetActorLocation(), GrabDetectionRadius);
 
-    ASwingPole* BestPole = nullptr;
-    float       BestDist = TNumericLimits<float>::Max();
+    if (!Segment || !Segment->Owner.IsValid()) return false;
 
-    for (const FOverlapResult& Result : Overlaps)
-    {
-        ASwingPole* Pole = Cast<ASwingPole>(Result.GetActor());
-        if (!Pole) continue;
-        if (Pole->GetActorLocation().Z <= Origin.Z) continue;  // must be above
+    OnGrabbed(*Segment);
+    return true;
+}
 
-        const float Dist = FVector::Dist(Origin, Pole->GetActorLocation());
-        if (Dist < BestDist) { BestDist = Dist; BestPole = Pole; }
-    }
+void USwingComponent::BufferGrab()
+{
+    UCharacterMovementComponent* CMC = OwnerCharacter->GetCharacterMovement();
+    USwingPoleSubsystem* Poles = GetWorld()->GetSubsystem<USwingPoleSubsystem>();
+    if (GrabBufferTime <= 0.0f || !CMC || !CMC->IsFalling() || !Poles) return;
+
+    // Solve the fall against the pole registry once, then wait for the intercept
+    float InterceptTime = -1.0f;
+    const FSwingPoleSegment* Segment = Poles->FindFirstIntercept(
+        OwnerCharacter->GetActorLocation(), CMC->Velocity, CMC->GetGravityZ(),
+        GrabDetectionRadius, GrabBufferTime, InterceptTime);
+    if (!Segment) return;
+
+    GetWorld()->GetTimerManager().SetTimer(
+        GrabBufferTimer, this, &USwingComponent::OnGrabBufferElapsed,
+        FMath::Max(InterceptTime, KINDA_SMALL_NUMBER), false);
+}
+
+void USwingComponent::OnGrabBufferElapsed()
+{
+    if (SwingState != ESwingState::None || !OwnerCharacter) return;
+
+    // Air control or a bump may have moved the character off the predicted arc
+    UCharacterMovementComponent* CMC = OwnerCharacter->GetCharacterMovement();
+    if (CMC && CMC->IsMovingOnGround()) return;
 
-    if (BestPole) OnGrabbed(BestPole);
+    GrabNearestPole();
 }
 
 // ---------------------------------------------------------------------------
 // Start grab
 // ---------------------------------------------------------------------------
 
-void USwingComponent::OnGrabbed(ASwingPole* Pole)
+void USwingComponent::OnGrabbed(const FSwingPoleSegment& Pole)
 {
     if (!OwnerCharacter)
         OwnerCharacter = Cast<ACharacter>(GetOwner());
 
-    CurrentPole        = Pole;
-    PivotWorldLocation = Pole->GetGrabPoint(OwnerCharacter->GetActorLocation());
+    const FVector Pivot  = Pole.GetGrabPoint(OwnerCharacter->GetActorLocation());
+    const FVector Offset = OwnerCharacter->GetActorLocation() - Pivot;
+    const float   Hang   = FMath::Max(FMath::Abs(Offset.Z), MinHangLength);
+    const float   Angle  = FMath::Atan2(Offset.X, -Offset.Z);
 
-    HangLength = FMath::Max(
-        FMath::Abs(PivotWorldLocation.Z - OwnerCharacter->GetActorLocation().Z),
-        60.0f);
+    if (IsNetworked())
+        SendGrab(Pole, Pivot, Hang, Angle);
+    else
+        StartGrab(Pole, Pivot, Hang, Angle);
+}
+
+void USwingComponent::StartGrab(const FSwingPoleSegment& Pole, const FVector& Pivot, float InHangLength, float Angle)
+{
+    GetWorld()->GetTimerManager().ClearTimer(GrabBufferTimer);
 
-    const FVector Offset = OwnerCharacter->GetActorLocation() - PivotWorldLocation;
-    SwingAngle           = FMath::Atan2(Offset.X, -Offset.Z);
+    CurrentPole          = Pole.Owner.Get();
+    CurrentPoleInstance  = Pole.InstanceIndex;
+    CurrentPoleDirection = Pole.Direction;
+    PivotWorldLocation   = Pivot;
+    HangLength           = InHangLength;
+
+    SwingAngle           = Angle;
     SwingAngularVelocity = 0.0f;
+    PrevSwingAngle       = SwingAngle;
+    FixedStepAccumulator = 0.0f;
+    NetCorrectionOffset  = 0.0f;
+
+    // Proxies swing from NetGrab and NetPendulum — replicated movement would resend the
+    // same motion at several times the size and fight the local pendulum
+    if (IsNetworked() && GetOwnerRole() == ROLE_Authority && !bMovementReplicationPaused)
+    {
+        bSavedReplicateMovement    = GetOwner()->IsReplicatingMovement();
+        bMovementReplicationPaused = true;
+        GetOwner()->SetReplicateMovement(false);
+    }
+
+    UpdateArcClearance();
 
     UCharacterMovementComponent* CMC = OwnerCharacter->GetCharacterMovement();
     if (CMC)
@@ -150,6 +252,7 @@ void USwingComponent::OnGrabbed(ASwingPole* Pole)
 
     GrabAlpha          = 0.0f;
     GrabStartLocation  = OwnerCharacter->GetActorLocation();
+    GrabStartLean      = SlopeLean;
     GrabTargetLocation = PivotWorldLocation
         + FVector(FMath::Sin(SwingAngle), 0.0f, -FMath::Cos(SwingAngle)) * HangLength;
 
@@ -160,6 +263,68 @@ void USwingComponent::OnGrabbed(ASwingPole* Pole)
 // Grabbing tick — smooth lerp to hang position
 // ---------------------------------------------------------------------------
 
+void USwingComponent::UpdateArcClearance()
+{
+    // Blueprints can write past the editor clamp
+    const float OpenLimit = FMath::Clamp(MaxSwingAngle, 0.0f, UE_PI);
+    SwingMinAngle       = -OpenLimit;
+    SwingMaxAngle       =  OpenLimit;
+    SwingMinRestitution = 0.0f;
+    SwingMaxRestitution = 0.0f;
+
+    const UCapsuleComponent* Capsule = OwnerCharacter->GetCapsuleComponent();
+    if (!bCheckArcClearance || !Capsule) return;
+
+    // Chord length per sweep, and how far to stay clear of a blocking surface
+    constexpr float ArcStep       = 0.25f;
+    constexpr float ContactMargin = 2.0f;
+
+    FCollisionQueryParams QueryParams(FName(TEXT("SwingArcClearance")), false, OwnerCharacter);
+    QueryParams.AddIgnoredActor(CurrentPole);
+    FCollisionResponseParams ResponseParams;
+    Capsule->InitSweepCollisionParams(QueryParams, ResponseParams);
+
+    const FCollisionShape   Shape   = Capsule->GetCollisionShape();
+    const ECollisionChannel Channel = Capsule->GetCollisionObjectType();
+    const float StartAngle = FMath::Clamp(SwingAngle, SwingMinAngle, SwingMaxAngle);
+    const float Margin     = ContactMargin / HangLength;
+
+    auto ArcPoint = [this](float Angle)
+    {
+        return PivotWorldLocation + FVector(FMath::Sin(Angle), 0.0f, -FMath::Cos(Angle)) * HangLength;
+    };
+
+    // Walk the arc out from the grab angle in both directions, stop at the first hit
+    for (const float Sign : { 1.0f, -1.0f })
+    {
+        float& Limit       = Sign > 0.0f ? SwingMaxAngle : SwingMinAngle;
+        float& Restitution = Sign > 0.0f ? SwingMaxRestitution : SwingMinRestitution;
+
+        for (float From = StartAngle; (Limit - From) * Sign > KINDA_SMALL_NUMBER; )
+        {
+            const float To = Sign > 0.0f ? FMath::Min(From + ArcStep, Limit) : FMath::Max(From - ArcStep, Limit);
+
+            FHitResult Hit;
+            ++FSwingStats::SceneQueries;
+            if (GetWorld()->SweepSingleByChannel(
+                    Hit, ArcPoint(From), ArcPoint(To), FQuat::Identity, Channel, Shape, QueryParams, ResponseParams))
+            {
+                // Already touching something at the grab point — nothing sensible to clamp to
+                if (Hit.bStartPenetrating && From == StartAngle) break;
+
+                const float HitAngle = FMath::Lerp(From, To, Hit.Time) - Sign * Margin;
+                Limit = Sign > 0.0f ? FMath::Max(HitAngle, StartAngle) : FMath::Min(HitAngle, StartAngle);
+
+                // Swinging into the obstacle rebounds, the open arc limit keeps pinning
+                Restitution = FSwingPendulumKernel::ClampRestitution;
+                break;
+            }
+
+            From = To;
+        }
+    }
+}
+
 void USwingComponent::TickGrabbing(float DeltaTime)
 {
     GrabAlpha += DeltaTime / FMath::Max(GrabTransitionTime, KINDA_SMALL_NUMBER);
@@ -174,54 +339,322 @@ void USwingComponent::TickGrabbing(float DeltaTime)
         GrabTargetLocation,
         FMath::SmoothStep(0.0f, 1.0f, GrabAlpha));
 
-    OwnerCharacter->SetActorLocation(NewPos, false, nullptr, ETeleportType::TeleportPhysics);
+    // Swept: a blocked approach waits at the contact, the arc itself was cleared at grab time
+    OwnerCharacter->SetActorLocation(NewPos, true, nullptr, ETeleportType::TeleportPhysics);
+    ++FSwingStats::TransformUpdates;
+    ++FSwingStats::SceneQueries;
+
+    // Straighten the walking lean over the transition so the swing starts upright
+    ApplySlopeLean(FMath::Lerp(GrabStartLean, FRotator::ZeroRotator, GrabAlpha));
+
+    if (SwingState == ESwingState::Swinging)
+        BeginSwinging();
 }
 
 // ---------------------------------------------------------------------------
-// Swinging tick — pendulum physics
+// Swinging — batched or per-component pendulum physics
 // ---------------------------------------------------------------------------
 
-void USwingComponent::TickSwinging(float DeltaTime)
+void USwingComponent::BeginSwinging()
+{
+    // Replay needs this swing's clamp interval
+    if (Recorder.IsEnabled())
+        Recorder.Add(FSwingRecordSample::MakeLimits(
+            SwingMinAngle, SwingMaxAngle, SwingMinRestitution, SwingMaxRestitution, HangLength));
+
+    SwingTime = 0.0f;
+    NetHistory.Reset();
+
+    if (SimulationMode == ESwingSimulationMode::Movement)
+    {
+        if (USwingMovementComponent* Movement =
+                Cast<USwingMovementComponent>(OwnerCharacter->GetCharacterMovement()))
+        {
+            Movement->StartSwing(this);
+            bMovementDriven = true;
+
+            // The movement component drives this component until release
+            SetComponentTickEnabled(false);
+            return;
+        }
+    }
+
+    if (SimulationMode == ESwingSimulationMode::Component) return;
+
+    // Reconciliation rewrites the pendulum, which the physics thread owns — batch it instead
+    if (SimulationMode == ESwingSimulationMode::AsyncPhysics && !IsNetworked())
+    {
+        USwingPhysicsSubsystem* Physics = GetWorld()->GetSubsystem<USwingPhysicsSubsystem>();
+        if (Physics && Physics->AddSwinger(this))
+        {
+            // The physics thread steps the pendulum, the subsystem applies it
+            SetComponentTickEnabled(false);
+            return;
+        }
+    }
+
+    if (USwingSimulationSubsystem* Sim = GetWorld()->GetSubsystem<USwingSimulationSubsystem>())
+    {
+        Sim->AddSwinger(this);
+
+        // The subsystem drives this component until release
+        SetComponentTickEnabled(false);
+    }
+}
+
+void USwingComponent::EndSwinging()
+{
+    if (bMovementDriven)
+    {
+        if (USwingMovementComponent* Movement =
+                Cast<USwingMovementComponent>(OwnerCharacter->GetCharacterMovement()))
+        {
+            Movement->StopSwing();
+        }
+        bMovementDriven = false;
+        SetComponentTickEnabled(true);
+    }
+
+    if (PhysicsSwingId != INDEX_NONE)
+    {
+        if (USwingPhysicsSubsystem* Physics = GetWorld()->GetSubsystem<USwingPhysicsSubsystem>())
+            Physics->RemoveSwinger(this);
+
+        PhysicsSwingId = INDEX_NONE;
+        SetComponentTickEnabled(true);
+    }
+
+    if (SimIndex == INDEX_NONE) return;
+
+    if (USwingSimulationSubsystem* Sim = GetWorld()->GetSubsystem<USwingSimulationSubsystem>())
+        Sim->RemoveSwinger(this);
+
+    SimIndex = INDEX_NONE;
+    SetComponentTickEnabled(true);
+}
+
+void USwingComponent::CommitSimulatedSwing(
+    float Angle, float AngularVelocity, float PrevAngle, float Accumulator,
+    const FVector& NewPos, const FVector& Velocity, float DeltaTime)
+{
+    SwingAngle           = Angle;
+    SwingAngularVelocity = AngularVelocity;
+    PrevSwingAngle       = PrevAngle;
+    FixedStepAccumulator = Accumulator;
+    CachedSwingVelocity  = Velocity;
+
+    ApplySwingTransform(NewPos, DeltaTime);
+    FinishSwingUpdate(DeltaTime);
+}
+
+void USwingComponent::FinishSwingUpdate(float DeltaTime)
+{
+    if (SwingState == ESwingState::Swinging)
+        SwingTime += DeltaTime;
+
+    PublishAnimSnapshot();
+    RecordSwingSample(DeltaTime);
+    UpdateNetSwing(DeltaTime);
+}
+
+void USwingComponent::RecordSwingSample(float DeltaTime)
+{
+    if (!Recorder.IsEnabled()) return;
+
+    Recorder.Add(FSwingRecordSample::MakeState(
+        static_cast<uint8>(SwingState), bJumpSinceLastSample, SwingAngle, SwingAngularVelocity,
+        PivotWorldLocation, HangLength, DeltaTime));
+    bJumpSinceLastSample = false;
+}
+
+bool USwingComponent::DumpRecording(const FString& Filename) const
 {
-    // α = -(g / L) * sin(θ)
-    constexpr float G     = 980.0f;
-    const float     Alpha = -(G / HangLength) * FMath::Sin(SwingAngle);
+    if (!Recorder.IsEnabled()) return false;
 
-    SwingAngularVelocity += Alpha * DeltaTime;
+    FSwingRecordHeader Header;
+    Header.AutoSwingForce = AutoSwingForce;
+    Header.SwingDamping   = SwingDamping;
+    Header.FixedStep      = GetFixedStep();
+    Header.MaxSubsteps    = MaxSubstepsPerFrame;
+    return Recorder.SaveToFile(Filename, Header);
+}
 
-    // Auto-swing: pump energy in the direction of current motion.
-    // When nearly stationary, push away from equilibrium based on angle.
-    const float Dir = FMath::Abs(SwingAngularVelocity) > 0.05f
-        ? FMath::Sign(SwingAngularVelocity)
-        : FMath::Sign(SwingAngle);
-    SwingAngularVelocity += Dir * AutoSwingForce * DeltaTime;
+float USwingComponent::GetFixedStep() const
+{
+    // Client and server must integrate with the same step for the prediction to hold
+    const bool bFixed = bUseFixedTimestep || IsNetworked();
+    return (bFixed && FixedSimulationRate > 0.0f) ? 1.0f / FixedSimulationRate : 0.0f;
+}
 
-    SwingAngularVelocity *= FMath::Pow(SwingDamping, DeltaTime * 60.0f);
+void USwingComponent::TickSwinging(float DeltaTime)
+{
+    if (UpdateSwingLOD(DeltaTime))
+    {
+        // SwingAngle already covers this frame — the estimate, or the caught-up state on exit
+        PrevSwingAngle = SwingAngle;
 
-    SwingAngle = FMath::Clamp(
-        SwingAngle + SwingAngularVelocity * DeltaTime,
-        -MaxSwingAngle, MaxSwingAngle);
+        CachedSwingVelocity = USwingSimulationSubsystem::GetTangentVelocity(
+            SwingAngle, SwingAngularVelocity, HangLength);
+        ApplySwingTransform(
+            PivotWorldLocation + FVector(FMath::Sin(SwingAngle), 0.0f, -FMath::Cos(SwingAngle)) * HangLength,
+            DeltaTime);
+        return;
+    }
+
+    ApplySwingTransform(AdvanceSwing(DeltaTime), DeltaTime);
+}
+
+FVector USwingComponent::AdvanceSwing(float DeltaTime)
+{
+    const float FixedStep   = GetFixedStep();
+    const float RenderAngle = USwingSimulationSubsystem::AdvancePendulum(
+        SwingAngle, SwingAngularVelocity, PrevSwingAngle, FixedStepAccumulator,
+        HangLength, AutoSwingForce, SwingDamping, SwingMinAngle, SwingMaxAngle,
+        FixedStep, MaxSubstepsPerFrame, DeltaTime, SwingMinRestitution, SwingMaxRestitution);
 
     const FVector OldPos = OwnerCharacter->GetActorLocation();
     const FVector NewPos = PivotWorldLocation
-        + FVector(FMath::Sin(SwingAngle), 0.0f, -FMath::Cos(SwingAngle)) * HangLength;
+        + FVector(FMath::Sin(RenderAngle), 0.0f, -FMath::Cos(RenderAngle)) * HangLength;
 
-    if (DeltaTime > KINDA_SMALL_NUMBER)
+    if (FixedStep > 0.0f)
+    {
+        CachedSwingVelocity = USwingSimulationSubsystem::GetTangentVelocity(
+            SwingAngle, SwingAngularVelocity, HangLength);
+    }
+    else if (DeltaTime > KINDA_SMALL_NUMBER)
     {
         CachedSwingVelocity = (NewPos - OldPos) / DeltaTime;
     }
 
-    OwnerCharacter->SetActorLocation(NewPos, false, nullptr, ETeleportType::TeleportPhysics);
+    return NewPos;
+}
+
+void USwingComponent::ResolveBlockedSwing(const FVector& Location, const FVector& OldLocation, float DeltaTime)
+{
+    // Angle of the swing-plane offset, measured like the arc: Pivot + (sin θ, 0, -cos θ) * L
+    const FVector Offset = Location - PivotWorldLocation;
+    SwingAngle     = FMath::Clamp(FMath::Atan2(Offset.X, -Offset.Z), SwingMinAngle, SwingMaxAngle);
+    PrevSwingAngle = SwingAngle;
+
+    // Keep only the motion along the arc that the slide let through
+    if (DeltaTime > KINDA_SMALL_NUMBER && HangLength > KINDA_SMALL_NUMBER)
+    {
+        const FVector Moved   = (Location - OldLocation) / DeltaTime;
+        const FVector Tangent = FVector(FMath::Cos(SwingAngle), 0.0f, FMath::Sin(SwingAngle));
+        SwingAngularVelocity  = FVector::DotProduct(Moved, Tangent) / HangLength;
+    }
+
+    CachedSwingVelocity = USwingSimulationSubsystem::GetTangentVelocity(
+        SwingAngle, SwingAngularVelocity, HangLength);
+}
 
+FRotator USwingComponent::GetSwingFacing(float DeltaTime) const
+{
     // Rotate character to face swing direction
-    const float     TSign  = (SwingAngularVelocity >= 0.0f) ? 1.0f : -1.0f;
+    const FRotator  Current = OwnerCharacter->GetActorRotation();
+    const float     TSign   = (SwingAngularVelocity >= 0.0f) ? 1.0f : -1.0f;
     const FVector   FaceDir = FVector(FMath::Cos(SwingAngle) * TSign, 0.0f, 0.0f);
-    if (!FaceDir.IsNearlyZero())
+    if (FaceDir.IsNearlyZero()) return Current;
+
+    return FMath::RInterpTo(Current, FaceDir.Rotation(), DeltaTime, 12.0f);
+}
+
+void USwingComponent::ApplySwingTransform(const FVector& NewPos, float DeltaTime)
+{
+    // Single transform update for position and facing
+    ++FSwingStats::TransformUpdates;
+    OwnerCharacter->SetActorLocationAndRotation(
+        BlendNetCorrection(NewPos, DeltaTime), GetSwingFacing(DeltaTime), false, nullptr, ETeleportType::TeleportPhysics);
+}
+
+FVector USwingComponent::BlendNetCorrection(const FVector& NewPos, float DeltaTime)
+{
+    if (NetCorrectionOffset == 0.0f) return NewPos;
+
+    const FVector Offset = NewPos - PivotWorldLocation;
+    const float   Angle  = FMath::Clamp(
+        FMath::Atan2(Offset.X, -Offset.Z) + NetCorrectionOffset, SwingMinAngle, SwingMaxAngle);
+
+    // 95 % gone after NetCorrectionBlendTime
+    NetCorrectionOffset *= FMath::Exp(-3.0f * DeltaTime / FMath::Max(NetCorrectionBlendTime, KINDA_SMALL_NUMBER));
+    if (FMath::Abs(NetCorrectionOffset) < KINDA_SMALL_NUMBER)
+        NetCorrectionOffset = 0.0f;
+
+    return PivotWorldLocation + FVector(FMath::Sin(Angle), 0.0f, -FMath::Cos(Angle)) * HangLength;
+}
+
+// ---------------------------------------------------------------------------
+// Swing LOD
+// ---------------------------------------------------------------------------
+
+bool USwingComponent::IsSwingSignificant() const
+{
+    if (!OwnerCharacter || OwnerCharacter->IsPlayerControlled()) return true;
+
+    // Off-screen swingers are never significant
+    if (!OwnerCharacter->WasRecentlyRendered(SwingLODInterval)) return false;
+
+    const FVector Location = OwnerCharacter->GetActorLocation();
+    for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
     {
-        const FRotator Target = FaceDir.Rotation();
-        OwnerCharacter->SetActorRotation(
-            FMath::RInterpTo(OwnerCharacter->GetActorRotation(), Target, DeltaTime, 12.0f));
+        const APlayerController* PC = It->Get();
+        if (!PC || !PC->IsLocalController() || !PC->PlayerCameraManager) continue;
+
+        const FVector CameraLocation = PC->PlayerCameraManager->GetCameraLocation();
+        if (FVector::DistSquared(CameraLocation, Location) < FMath::Square(SwingLODDistance))
+            return true;
     }
+    return false;
+}
+
+bool USwingComponent::UpdateSwingLOD(float DeltaTime)
+{
+    if (!bEnableSwingLOD) return false;
+
+    bool bExit = false;
+
+    SignificanceTimer -= DeltaTime;
+    if (SignificanceTimer <= 0.0f)
+    {
+        SignificanceTimer = SwingLODInterval;
+
+        const bool bSignificant = IsSwingSignificant();
+        if (!bSignificant && !SwingLOD.IsActive())
+        {
+            const float FixedStep = GetFixedStep();
+            SwingLOD.Enter(SwingAngle, SwingAngularVelocity,
+                           HangLength, AutoSwingForce, SwingDamping, SwingMinAngle, SwingMaxAngle,
+                           SwingMinRestitution, SwingMaxRestitution, FixedStep > 0.0f ? FixedStep : DeltaTime);
+
+            // Tick at the LOD rate — DeltaTime then covers the whole interval
+            SetComponentTickInterval(SwingLODInterval);
+        }
+        else if (bSignificant && SwingLOD.IsActive())
+        {
+            bExit = true;
+        }
+    }
+
+    if (!SwingLOD.IsActive()) return false;
+
+    // A whole LOD interval can land in this frame — on exit the replay covers it
+    // at the swinger's own step instead of one long AdvanceSwing
+    SwingLOD.Advance(DeltaTime, SwingAngle, SwingAngularVelocity);
+    if (bExit) ExitSwingLOD();
+    return true;
+}
+
+void USwingComponent::ExitSwingLOD()
+{
+    if (!SwingLOD.IsActive()) return;
+
+    SwingLOD.Exit(SwingAngle, SwingAngularVelocity);
+    PrevSwingAngle       = SwingAngle;
+    FixedStepAccumulator = 0.0f;
+    CachedSwingVelocity  = USwingSimulationSubsystem::GetTangentVelocity(
+        SwingAngle, SwingAngularVelocity, HangLength);
+
+    SetComponentTickInterval(0.0f);
 }
 
 // ---------------------------------------------------------------------------
@@ -230,6 +663,37 @@ void USwingComponent::TickSwinging(float DeltaTime)
 
 void USwingComponent::Release()
 {
+    DropFromPole();
+
+    OwnerCharacter->LaunchCharacter(CalcLaunchVelocity(), true, true);
+
+    if (!IsNetworked()) return;
+
+    if (GetOwnerRole() == ROLE_AutonomousProxy)
+    {
+        ServerRelease(SwingTime);
+    }
+    else if (GetOwnerRole() == ROLE_Authority)
+    {
+        NetGrab.Pole = nullptr;
+    }
+}
+
+void USwingComponent::DropFromPole()
+{
+    GetWorld()->GetTimerManager().ClearTimer(GrabBufferTimer);
+    EndSwinging();
+
+    // Per-component LOD: launch from the caught-up state, not the last estimate
+    if (SwingLOD.IsActive())
+    {
+        ExitSwingLOD();
+        OwnerCharacter->SetActorLocation(
+            PivotWorldLocation + FVector(FMath::Sin(SwingAngle), 0.0f, -FMath::Cos(SwingAngle)) * HangLength,
+            false, nullptr, ETeleportType::TeleportPhysics);
+        ++FSwingStats::TransformUpdates;
+    }
+
     SwingState = ESwingState::None;
 
     UCharacterMovementComponent* CMC = OwnerCharacter->GetCharacterMovement();
@@ -241,10 +705,328 @@ void USwingComponent::Release()
         // Remove air braking so horizontal momentum is preserved in flight
         CMC->BrakingDecelerationFalling = 0.0f;
         bNeedsDecelRestore = true;
+
+        if (bClientErrorsIgnored)
+        {
+            CMC->bIgnoreClientMovementErrorChecksAndCorrection = bSavedIgnoreClientErrors;
+            bClientErrorsIgnored = false;
+        }
     }
 
-    OwnerCharacter->LaunchCharacter(CalcLaunchVelocity(), true, true);
-    CurrentPole = nullptr;
+    // The launch replicates as ordinary movement again
+    if (bMovementReplicationPaused)
+    {
+        GetOwner()->SetReplicateMovement(bSavedReplicateMovement);
+        bMovementReplicationPaused = false;
+    }
+    NetCorrectionOffset = 0.0f;
+
+    CurrentPole         = nullptr;
+    CurrentPoleInstance = INDEX_NONE;
+}
+
+// ---------------------------------------------------------------------------
+// Networking — the server owns the swing, the owning client predicts it
+// ---------------------------------------------------------------------------
+
+void USwingComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    // The owner predicts its own grabs; NetPendulum still goes to it for reconciliation
+    DOREPLIFETIME_CONDITION(USwingComponent, NetGrab, COND_SkipOwner);
+    DOREPLIFETIME(USwingComponent, NetPendulum);
+}
+
+bool USwingComponent::IsNetworked() const
+{
+    return GetNetMode() != NM_Standalone && GetOwner() && GetOwner()->GetIsReplicated();
+}
+
+float USwingComponent::GetSimulatedSwingTime() const
+{
+    // Fixed-step mode: the pendulum state lags the frame clock by the unsimulated time
+    return SwingTime - FixedStepAccumulator;
+}
+
+void USwingComponent::StepSwingFor(float& Angle, float& AngularVelocity, float Duration) const
+{
+    const float FixedStep = GetFixedStep();
+    const float MaxStep   = FixedStep > 0.0f ? FixedStep : MaxNetStep;
+
+    while (Duration > KINDA_SMALL_NUMBER)
+    {
+        const float Step = FMath::Min(Duration, MaxStep);
+        USwingSimulationSubsystem::StepPendulum(
+            Angle, AngularVelocity, HangLength, AutoSwingForce, SwingDamping,
+            SwingMinAngle, SwingMaxAngle, Step, SwingMinRestitution, SwingMaxRestitution);
+        Duration -= Step;
+    }
+}
+
+void USwingComponent::SendGrab(const FSwingPoleSegment& Pole, const FVector& Pivot, float InHangLength, float Angle)
+{
+    FSwingNetGrab Grab;
+    Grab.Set(Pole.Owner.Get(), Pole.InstanceIndex,
+             FVector::DotProduct(Pivot - Pole.Center, Pole.Direction), InHangLength, Angle);
+    Grab.Sequence = ++GrabSequence;
+
+    // Start from the quantized grab so every machine swings the same pendulum
+    if (!ApplyNetGrab(Grab)) return;
+
+    if (GetOwnerRole() == ROLE_AutonomousProxy)
+    {
+        const AGameStateBase* GameState = GetWorld()->GetGameState();
+        ServerGrab(Grab, GameState ? GameState->GetServerWorldTimeSeconds() : 0.0f);
+    }
+    else if (GetOwnerRole() == ROLE_Authority)
+    {
+        NetGrab = Grab;
+    }
+}
+
+bool USwingComponent::ApplyNetGrab(const FSwingNetGrab& Grab)
+{
+    FSwingPoleSegment Segment;
+    if (!ResolveNetGrab(Grab, Segment)) return false;
+
+    if (!OwnerCharacter)
+        OwnerCharacter = Cast<ACharacter>(GetOwner());
+
+    const FVector Pivot = Segment.GetGrabPoint(Segment.Center + Segment.Direction * Grab.GetPivotOffset());
+    StartGrab(Segment, Pivot, Grab.GetHangLength(), Grab.GetStartAngle());
+    return true;
+}
+
+bool USwingComponent::ResolveNetGrab(const FSwingNetGrab& Grab, FSwingPoleSegment& OutSegment)
+{
+    if (const ASwingPole* Pole = Cast<ASwingPole>(Grab.Pole))
+    {
+        OutSegment = Pole->GetSegment();
+        return true;
+    }
+
+    const ASwingPoleField* Field = Cast<ASwingPoleField>(Grab.Pole);
+    if (!Field || Grab.InstanceIndex == MAX_uint16 || Grab.InstanceIndex >= Field->GetNumPoles())
+        return false;
+
+    OutSegment = Field->GetSegment(Grab.InstanceIndex);
+    return true;
+}
+
+void USwingComponent::ServerGrab_Implementation(const FSwingNetGrab& Grab, float ClientServerTime)
+{
+    if (!OwnerCharacter)
+        OwnerCharacter = Cast<ACharacter>(GetOwner());
+
+    const AGameStateBase* GameState = GetWorld()->GetGameState();
+    const float Age = GameState ? GameState->GetServerWorldTimeSeconds() - ClientServerTime : 0.0f;
+
+    // The client can only have grabbed what this character could reach by now
+    FSwingPoleSegment Segment;
+    bool bValid = OwnerCharacter && Age <= NetMaxGrabAge && ResolveNetGrab(Grab, Segment)
+        && FMath::Abs(Grab.GetPivotOffset()) <= Segment.HalfLength + 1.0f;
+
+    if (bValid)
+    {
+        const FVector Pivot = Segment.GetGrabPoint(Segment.Center + Segment.Direction * Grab.GetPivotOffset());
+        const float   Reach = GrabDetectionRadius + Segment.Reach + NetGrabTolerance;
+        bValid = FVector::DistSquared(OwnerCharacter->GetActorLocation(), Pivot) <= FMath::Square(Reach)
+              && Grab.GetHangLength() <= Reach;
+    }
+
+    if (!bValid)
+    {
+        ClientRejectGrab(Grab.Sequence);
+        return;
+    }
+
+    if (SwingState != ESwingState::None)
+        DropFromPole();
+
+    ApplyNetGrab(Grab);
+    NetGrab = Grab;
+
+    // Both sides move the character along the arc; the client's moves would only fight it
+    if (UCharacterMovementComponent* CMC = OwnerCharacter->GetCharacterMovement())
+    {
+        bSavedIgnoreClientErrors = CMC->bIgnoreClientMovementErrorChecksAndCorrection;
+        bClientErrorsIgnored     = true;
+        CMC->bIgnoreClientMovementErrorChecksAndCorrection = true;
+    }
+}
+
+void USwingComponent::ClientRejectGrab_Implementation(uint8 Sequence)
+{
+    // A later grab has already replaced the rejected one
+    if (Sequence != GrabSequence || SwingState == ESwingState::None) return;
+
+    DropFromPole();
+}
+
+void USwingComponent::ServerRelease_Implementation(float ReleaseSwingTime)
+{
+    if (SwingState == ESwingState::None) return;
+
+    // The client let go right after its transition ended — finish ours first
+    if (SwingState == ESwingState::Grabbing)
+    {
+        GrabAlpha  = 1.0f;
+        SwingState = ESwingState::Swinging;
+        OwnerCharacter->SetActorLocation(GrabTargetLocation, false, nullptr, ETeleportType::TeleportPhysics);
+        ++FSwingStats::TransformUpdates;
+        ApplySlopeLean(FRotator::ZeroRotator);
+        BeginSwinging();
+    }
+
+    CatchUpSwing(ReleaseSwingTime);
+    Release();
+}
+
+void USwingComponent::CatchUpSwing(float TargetSwingTime)
+{
+    // Never rewinds — a client behind the server releases from the server's state
+    const float Duration = FMath::Min(TargetSwingTime - SwingTime, NetMaxGrabAge);
+    if (Duration <= 0.0f) return;
+
+    float Angle           = SwingAngle;
+    float AngularVelocity = SwingAngularVelocity;
+    StepSwingFor(Angle, AngularVelocity, Duration);
+
+    SetPendulumState(Angle, AngularVelocity);
+    SwingTime += Duration;
+
+    OwnerCharacter->SetActorLocation(
+        PivotWorldLocation + FVector(FMath::Sin(SwingAngle), 0.0f, -FMath::Cos(SwingAngle)) * HangLength,
+        false, nullptr, ETeleportType::TeleportPhysics);
+    ++FSwingStats::TransformUpdates;
+}
+
+void USwingComponent::UpdateNetSwing(float DeltaTime)
+{
+    if (SwingState != ESwingState::Swinging || !IsNetworked()) return;
+
+    if (GetOwnerRole() == ROLE_Authority)
+    {
+        NetPendulum.Set(SwingAngle, SwingAngularVelocity, GetSimulatedSwingTime());
+    }
+    else if (GetOwnerRole() == ROLE_AutonomousProxy && DeltaTime > 0.0f)
+    {
+        if (NetHistory.Num() == NetHistoryCapacity)
+            NetHistory.RemoveAt(0, 1, EAllowShrinking::No);
+
+        NetHistory.Add({ GetSimulatedSwingTime(), SwingAngle, SwingAngularVelocity });
+    }
+}
+
+void USwingComponent::OnRep_NetPendulum()
+{
+    if (SwingState != ESwingState::Swinging) return;
+
+    if (GetOwnerRole() == ROLE_AutonomousProxy)
+        ReconcileSwing();
+    else
+        CorrectPendulumState(NetPendulum.GetAngle(), NetPendulum.GetAngularVelocity());
+}
+
+void USwingComponent::ReconcileSwing()
+{
+    // Latest predicted state at or before the server's, by the wrapping millisecond clock
+    int32 Match = INDEX_NONE;
+    int32 Lead  = 0;
+    for (int32 i = NetHistory.Num() - 1; i >= 0; --i)
+    {
+        const int16 Diff = static_cast<int16>(
+            NetPendulum.SwingTime - FSwingNetPendulum::QuantizeSwingTime(NetHistory[i].SwingTime));
+        if (Diff < 0) continue;
+        if (Diff <= NetMatchWindowMs)
+        {
+            Match = i;
+            Lead  = Diff;
+        }
+        break;
+    }
+    if (Match == INDEX_NONE) return;
+
+    // Bring the prediction to the server's time before comparing
+    const float ServerTime = NetHistory[Match].SwingTime + Lead * 0.001f;
+    float PredictedAngle           = NetHistory[Match].Angle;
+    float PredictedAngularVelocity = NetHistory[Match].AngularVelocity;
+    StepSwingFor(PredictedAngle, PredictedAngularVelocity, Lead * 0.001f);
+
+    const float ServerAngle           = NetPendulum.GetAngle();
+    const float ServerAngularVelocity = NetPendulum.GetAngularVelocity();
+    const float AngleError            = FMath::Abs(ServerAngle - PredictedAngle);
+    const float AngularVelocityError  = FMath::Abs(ServerAngularVelocity - PredictedAngularVelocity);
+
+    if (AngleError <= NetCorrectionAngle && AngularVelocityError <= NetCorrectionAngularVelocity)
+        return;
+
+    // Replay the predictions made since then on top of the server state
+    float Angle           = ServerAngle;
+    float AngularVelocity = ServerAngularVelocity;
+    float Time            = ServerTime;
+    for (int32 i = Match + 1; i < NetHistory.Num(); ++i)
+    {
+        StepSwingFor(Angle, AngularVelocity, NetHistory[i].SwingTime - Time);
+        Time = NetHistory[i].SwingTime;
+
+        NetHistory[i].Angle           = Angle;
+        NetHistory[i].AngularVelocity = AngularVelocity;
+    }
+    NetHistory.RemoveAt(0, Match + 1, EAllowShrinking::No);
+
+    CorrectPendulumState(Angle, AngularVelocity);
+    ++FSwingStats::NetCorrections;
+
+    if (CVarSwingNetLogCorrections.GetValueOnGameThread())
+    {
+        UE_LOG(LogSwingGame, Log,
+            TEXT("%s: swing corrected at %.3f s (angle error %.4f rad, angular velocity error %.3f rad/s)"),
+            *GetNameSafe(GetOwner()), ServerTime, AngleError, AngularVelocityError);
+    }
+}
+
+void USwingComponent::OnRep_NetGrab()
+{
+    if (GetOwnerRole() != ROLE_SimulatedProxy) return;
+
+    if (SwingState != ESwingState::None)
+        DropFromPole();
+
+    if (NetGrab.IsGrabbed())
+        ApplyNetGrab(NetGrab);
+}
+
+void USwingComponent::SetPendulumState(float Angle, float AngularVelocity)
+{
+    if (SimIndex != INDEX_NONE)
+    {
+        if (USwingSimulationSubsystem* Sim = GetWorld()->GetSubsystem<USwingSimulationSubsystem>())
+            Sim->SetSwingerState(this, Angle, AngularVelocity);
+    }
+
+    ExitSwingLOD();
+
+    SwingAngle           = Angle;
+    SwingAngularVelocity = AngularVelocity;
+    PrevSwingAngle       = Angle;
+    CachedSwingVelocity  = USwingSimulationSubsystem::GetTangentVelocity(Angle, AngularVelocity, HangLength);
+    NetCorrectionOffset  = 0.0f;
+}
+
+void USwingComponent::CorrectPendulumState(float Angle, float AngularVelocity)
+{
+    // Where the character is drawn, including what is left of an earlier correction
+    const FVector Offset        = OwnerCharacter->GetActorLocation() - PivotWorldLocation;
+    const float   RenderedAngle = FMath::Atan2(Offset.X, -Offset.Z);
+
+    SetPendulumState(Angle, AngularVelocity);
+
+    // Small errors fade out from the drawn pose, large ones snap
+    const float Error = RenderedAngle - Angle;
+    if (FMath::Abs(Error) <= NetSnapAngle && NetCorrectionBlendTime > 0.0f)
+        NetCorrectionOffset = Error;
 }
 
 // ---------------------------------------------------------------------------
@@ -258,37 +1040,22 @@ void USwingComponent::TickWalkingSlope(float DeltaTime)
     UCharacterMovementComponent* CMC = OwnerCharacter->GetCharacterMovement();
     if (!CMC) return;
 
-    // Get character feet location for trace
-    FVector TraceStart = OwnerCharacter->GetActorLocation();
-    FVector TraceEnd = TraceStart - FVector(0.0f, 0.0f, 200.0f);
-
-    // Trace to find ground surface
-    FHitResult HitResult;
-    FCollisionQueryParams QueryParams(FName(TEXT("SlopeTrace")), false, OwnerCharacter);
-
-    bool bHit = GetWorld()->LineTraceSingleByChannel(
-        HitResult,
-        TraceStart,
-        TraceEnd,
-        ECC_WorldStatic,
-        QueryParams);
+    // Reuse the floor the CMC already found this frame — no trace of our own
+    const FFindFloorResult& Floor = CMC->CurrentFloor;
 
-    if (!bHit || !HitResult.IsValidBlockingHit())
+    if (!Floor.IsWalkableFloor())
     {
-        // No ground found, return to upright rotation
-        FRotator CurrentRot = OwnerCharacter->GetActorRotation();
-        FRotator TargetRot(0.0f, CurrentRot.Yaw, 0.0f);
-        OwnerCharacter->SetActorRotation(
-            FMath::RInterpTo(CurrentRot, TargetRot, DeltaTime, 5.0f));
+        // No ground found, return to upright
+        ApplySlopeLean(FMath::RInterpTo(SlopeLean, FRotator::ZeroRotator, DeltaTime, 5.0f));
         return;
     }
 
     // Get surface normal
-    FVector SurfaceNormal = HitResult.ImpactNormal;
+    const FVector SurfaceNormal = Floor.HitResult.ImpactNormal;
 
     // Base pitch from surface normal (character follows terrain)
     float PitchAngle = FMath::Atan2(-SurfaceNormal.X, SurfaceNormal.Z);
-    float RollAngle = FMath::Atan2(SurfaceNormal.Y, SurfaceNormal.Z);
+    float RollAngle  = FMath::Atan2(SurfaceNormal.Y, SurfaceNormal.Z);
 
     // Factor in movement direction for additional dynamic lean
     FVector Velocity = CMC->Velocity;
@@ -302,16 +1069,46 @@ void USwingComponent::TickWalkingSlope(float DeltaTime)
         PitchAngle += FMath::DegreesToRadians(MovementLean);
     }
 
-    // Create target rotation (preserve character's yaw)
-    FRotator CurrentRot = OwnerCharacter->GetActorRotation();
-    FRotator TargetRot(
+    // Pitch and roll on top of the actor's yaw — the actor itself stays upright
+    const FRotator TargetLean(
         FMath::RadiansToDegrees(PitchAngle),
-        CurrentRot.Yaw,
+        0.0f,
         FMath::RadiansToDegrees(RollAngle));
 
-    // Smoothly interpolate to target rotation
-    FRotator NewRot = FMath::RInterpTo(CurrentRot, TargetRot, DeltaTime, 5.0f);
-    OwnerCharacter->SetActorRotation(NewRot);
+    // Smoothly interpolate to target lean
+    ApplySlopeLean(FMath::RInterpTo(SlopeLean, TargetLean, DeltaTime, 5.0f));
+}
+
+void USwingComponent::ApplySlopeLean(const FRotator& Lean)
+{
+    USkeletalMeshComponent* Mesh = OwnerCharacter->GetMesh();
+    if (!Mesh || Lean.Equals(SlopeLean, 0.01f)) return;
+
+    SlopeLean = Lean;
+
+    // Rotates about the mesh origin (the feet) rather than the capsule centre.
+    // The character's base mesh offset carries the lean, so network smoothing,
+    // which rebuilds the mesh transform from it, layers its offset on top
+    const FQuat LeanedRotation = Lean.Quaternion() * BaseMeshRotation;
+    OwnerCharacter->CacheInitialMeshOffset(OwnerCharacter->GetBaseTranslationOffset(), LeanedRotation.Rotator());
+
+    FQuat SmoothingOffset = FQuat::Identity;
+    UCharacterMovementComponent* CMC = OwnerCharacter->GetCharacterMovement();
+    if (CMC && CMC->HasPredictionData_Client())
+        SmoothingOffset = CMC->GetPredictionData_Client_Character()->MeshRotationOffset;
+
+    Mesh->SetRelativeRotation(SmoothingOffset * LeanedRotation);
+    ++FSwingStats::TransformUpdates;
+}
+
+FSwingLaunchPrediction USwingComponent::PredictRelease(float LandingZ) const
+{
+    if (SwingState != ESwingState::Swinging) return FSwingLaunchPrediction();
+
+    // Release restores GravityScale to 1, so flight uses plain world gravity
+    return FSwingLaunchPrediction::Predict(
+        PivotWorldLocation, HangLength, SwingAngle, SwingAngularVelocity,
+        LaunchSpeedMultiplier, -GetWorld()->GetGravityZ(), LandingZ);
 }
 
 FVector USwingComponent::CalcLaunchVelocity() const
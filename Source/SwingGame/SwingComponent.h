@@ -2,6 +2,10 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "SwingLaunchPrediction.h"
+#include "SwingNetState.h"
+#include "SwingPendulumEnvelope.h"
+#include "SwingRecorder.h"
 #include "SwingComponent.generated.h"
 
 UENUM(BlueprintType)
@@ -13,6 +17,45 @@ enum class ESwingState : uint8
     Releasing UMETA(DisplayName = "Releasing")
 };
 
+/** Who steps the pendulum once the grab transition has finished */
+UENUM(BlueprintType)
+enum class ESwingSimulationMode : uint8
+{
+    Component    UMETA(DisplayName = "Component Tick"),  // this component steps and places the character
+    Batched      UMETA(DisplayName = "Batched"),         // USwingSimulationSubsystem, with every other swinger
+    Movement     UMETA(DisplayName = "Movement Mode"),   // USwingMovementComponent's custom swing mode
+    AsyncPhysics UMETA(DisplayName = "Async Physics")    // USwingPhysicsSubsystem, on the physics thread
+};
+
+/**
+ * Swing state as seen by animation. Published by USwingComponent whenever its
+ * state changes, so anim instances copy one struct instead of reading the component.
+ */
+USTRUCT(BlueprintType)
+struct SWINGGAME_API FSwingAnimSnapshot
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Swing")
+    ESwingState SwingState = ESwingState::None;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Swing")
+    bool bIsSwinging = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Swing")
+    float SwingAngle = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Swing")
+    float SwingAngularVelocity = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Swing")
+    FVector PivotLocation = FVector::ZeroVector;
+
+    /** Unit axis of the grabbed pole */
+    UPROPERTY(BlueprintReadOnly, Category = "Swing")
+    FVector PoleDirection = FVector::RightVector;
+};
+
 /**
  * Add to ASwingGameCharacter to enable pole-swinging.
  * The character swings automatically once grabbed — the player can only jump off.
@@ -33,6 +76,10 @@ public:
         ELevelTick TickType,
         FActorComponentTickFunction* ThisTickFunction) override;
 
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
     // -----------------------------------------------------------------------
     // Input API
     // -----------------------------------------------------------------------
@@ -45,6 +92,11 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Swing")
     void AddSwingInput(float AxisValue);
 
+    /** Where the character lands (on the plane Z = LandingZ) if it released right now.
+     *  Closed form, cheap enough to call every frame. Invalid unless swinging. */
+    UFUNCTION(BlueprintCallable, Category = "Swing")
+    FSwingLaunchPrediction PredictRelease(float LandingZ) const;
+
     // -----------------------------------------------------------------------
     // State — read by AnimBP and Character
     // -----------------------------------------------------------------------
@@ -68,6 +120,15 @@ public:
     UPROPERTY(BlueprintReadOnly, Category = "Swing|State")
     FVector PivotWorldLocation = FVector::ZeroVector;
 
+    /** State published for animation at the end of the last swing update */
+    const FSwingAnimSnapshot& GetAnimSnapshot() const { return AnimSnapshot; }
+
+    /** Pivot to character distance of the current swing (cm) */
+    float GetHangLength() const { return HangLength; }
+
+    /** Shortest hang a grab produces — grabbing level with the pole still hangs this far below it (cm) */
+    static constexpr float MinHangLength = 60.0f;
+
     // -----------------------------------------------------------------------
     // Tuning
     // -----------------------------------------------------------------------
@@ -75,6 +136,11 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Swing|Settings")
     float GrabDetectionRadius = 220.0f;
 
+    /** A mid-air press with no pole in reach still grabs if the fall carries the character
+     *  into reach of one within this many seconds (0 = only grab on the press itself) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Swing|Settings", meta = (ClampMin = 0))
+    float GrabBufferTime = 0.2f;
+
     /** Force applied automatically each frame to keep the swing going.
      *  Acts in the direction of current angular velocity (energy pumping). */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Swing|Settings")
@@ -89,33 +155,278 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Swing|Settings")
     float SwingDamping = 0.988f;
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Swing|Settings")
+    /** Swing limit either side of hanging straight down (rad); StepBatch is only valid up to π */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Swing|Settings", meta = (ClampMin = 0, ClampMax = 3.14159))
     float MaxSwingAngle = 2.2f;
 
+    /** Sweep the capsule along the swing arc once per grab and stop the swing short of
+     *  anything in the way, instead of swinging through walls and props */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Swing|Settings")
+    bool bCheckArcClearance = true;
+
+    /** Batched: stepped in USwingSimulationSubsystem together with every other swinger;
+     *  tuning is captured when the swing starts. Movement: integrated inside the character's
+     *  USwingMovementComponent (falls back to Batched with a plain CMC). Async Physics: stepped
+     *  by USwingPhysicsSubsystem inside the Chaos solver at the physics step, results applied on
+     *  the game thread (falls back to Batched without async physics or a physics scene). In all of these this
+     *  component stops ticking while swinging. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Swing|Settings")
+    ESwingSimulationMode SimulationMode = ESwingSimulationMode::Batched;
+
+    /** Integrate the swing at FixedSimulationRate instead of once per frame, so amplitude and
+     *  launch speed don't depend on frame rate. Rendering interpolates between fixed steps.
+     *  Networked swings always step at the fixed rate, so client and server integrate alike. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Swing|Settings")
+    bool bUseFixedTimestep = false;
+
+    /** Fixed integration rate (Hz) when bUseFixedTimestep is set or the swing is networked */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Swing|Settings", meta = (ClampMin = 30))
+    float FixedSimulationRate = 120.0f;
+
+    /** Upper bound of fixed steps run in one frame — a hitch beyond that is dropped */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Swing|Settings", meta = (ClampMin = 1, EditCondition = "bUseFixedTimestep"))
+    int32 MaxSubstepsPerFrame = 8;
+
+    /** Drop AI swingers that are off-screen or far from every local camera to a
+     *  closed-form pendulum evaluated every SwingLODInterval. They catch up exactly
+     *  when they become significant again or release. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Swing|LOD")
+    bool bEnableSwingLOD = true;
+
+    /** Distance from the nearest local camera beyond which a swinger is insignificant (cm) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Swing|LOD", meta = (EditCondition = "bEnableSwingLOD"))
+    float SwingLODDistance = 3000.0f;
+
+    /** Update and significance-check interval while in swing LOD (s) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Swing|LOD", meta = (ClampMin = 0.05, EditCondition = "bEnableSwingLOD"))
+    float SwingLODInterval = 0.25f;
+
+    /** Keep the last SwingRecordCapacity swing ticks in memory (16 bytes each) for
+     *  Swing.DumpRecordings and Swing.Replay. Read on BeginPlay. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Swing|Recording")
+    bool bRecordSwing = true;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Swing|Recording", meta = (ClampMin = 1, EditCondition = "bRecordSwing"))
+    int32 SwingRecordCapacity = 4096;
+
+    /** Writes the recorded swing history to Filename. False if recording is off or the write failed. */
+    bool DumpRecording(const FString& Filename) const;
+
+    /** Extra distance the server allows between its character and a grab the client reports (cm) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Swing|Network", meta = (ClampMin = 0))
+    float NetGrabTolerance = 150.0f;
+
+    /** Oldest client grab the server still accepts, by its server-time stamp (s) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Swing|Network", meta = (ClampMin = 0))
+    float NetMaxGrabAge = 1.0f;
+
+    /** Prediction error that makes the owning client re-simulate from the server state */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Swing|Network", meta = (ClampMin = 0))
+    float NetCorrectionAngle = 0.02f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Swing|Network", meta = (ClampMin = 0))
+    float NetCorrectionAngularVelocity = 0.2f;
+
+    /** Corrections moving the character further than this along the arc snap to it (rad) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Swing|Network", meta = (ClampMin = 0))
+    float NetSnapAngle = 0.25f;
+
+    /** Smaller corrections fade out over this time instead of popping the character (s) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Swing|Network", meta = (ClampMin = 0))
+    float NetCorrectionBlendTime = 0.1f;
+
 private:
+    friend class USwingSimulationSubsystem;
+    friend class USwingMovementComponent;
+    friend class USwingPhysicsSubsystem;
+
     void TryGrab();
-    void OnGrabbed(class ASwingPole* Pole);
+    void BufferGrab();
+    void OnGrabBufferElapsed();
+    bool GrabNearestPole();
+    void OnGrabbed(const struct FSwingPoleSegment& Pole);
+    void StartGrab(const struct FSwingPoleSegment& Pole, const FVector& Pivot, float InHangLength, float Angle);
     void TickGrabbing(float DeltaTime);
+    void UpdateArcClearance();
     void TickSwinging(float DeltaTime);
+    void BeginSwinging();
+    void EndSwinging();
+    FVector AdvanceSwing(float DeltaTime);
+    FRotator GetSwingFacing(float DeltaTime) const;
+
+    /** Re-derives the pendulum from where a blocked move actually left the character */
+    void ResolveBlockedSwing(const FVector& Location, const FVector& OldLocation, float DeltaTime);
+    void ApplySwingTransform(const FVector& NewPos, float DeltaTime);
+
+    /** NewPos moved along the arc by what is left of the last network correction, which then fades */
+    FVector BlendNetCorrection(const FVector& NewPos, float DeltaTime);
+    void CommitSimulatedSwing(float Angle, float AngularVelocity, float PrevAngle, float Accumulator,
+                              const FVector& NewPos, const FVector& Velocity, float DeltaTime);
+
+    /** Fixed integration step in seconds, 0 when stepping on frame time */
+    float GetFixedStep() const;
+
+    /** False when nobody can see this swing closely enough to need full simulation */
+    bool IsSwingSignificant() const;
+
+    /** Per-component path: enters/leaves swing LOD and advances it by DeltaTime.
+     *  True when LOD covered this frame, including the frame it is left on. */
+    bool UpdateSwingLOD(float DeltaTime);
+    void ExitSwingLOD();
     void TickWalkingSlope(float DeltaTime);
+    void ApplySlopeLean(const FRotator& Lean);
+    void PublishAnimSnapshot();
+    void RecordSwingSample(float DeltaTime);
+
+    /** End of every swing update, whoever drove it: anim snapshot, recorder, network */
+    void FinishSwingUpdate(float DeltaTime);
+
     void Release();
+
+    /** Lets go of the pole without a launch — rejected grabs and replicated releases */
+    void DropFromPole();
     FVector CalcLaunchVelocity() const;
 
+    // Networking — server-authoritative, the owning client predicts
+    bool IsNetworked() const;
+    void SendGrab(const struct FSwingPoleSegment& Pole, const FVector& Pivot, float InHangLength, float Angle);
+    bool ApplyNetGrab(const FSwingNetGrab& Grab);
+    static bool ResolveNetGrab(const FSwingNetGrab& Grab, struct FSwingPoleSegment& OutSegment);
+    void UpdateNetSwing(float DeltaTime);
+    void ReconcileSwing();
+
+    /** Overwrites the pendulum wherever it is being stepped */
+    void SetPendulumState(float Angle, float AngularVelocity);
+
+    /** SetPendulumState for a network correction — blended from the rendered pose below NetSnapAngle */
+    void CorrectPendulumState(float Angle, float AngularVelocity);
+
+    /** Server: steps the swing forward to the client's swing clock before acting on its RPC */
+    void CatchUpSwing(float TargetSwingTime);
+
+    /** Swing clock of the current pendulum state, as replicated */
+    float GetSimulatedSwingTime() const;
+
+    /** Steps a copy of this swing's pendulum over Duration, in fixed or bounded steps */
+    void StepSwingFor(float& Angle, float& AngularVelocity, float Duration) const;
+
+    UFUNCTION(Server, Reliable)
+    void ServerGrab(const FSwingNetGrab& Grab, float ClientServerTime);
+
+    UFUNCTION(Server, Reliable)
+    void ServerRelease(float ReleaseSwingTime);
+
+    UFUNCTION(Client, Reliable)
+    void ClientRejectGrab(uint8 Sequence);
+
+    UFUNCTION()
+    void OnRep_NetGrab();
+
+    UFUNCTION()
+    void OnRep_NetPendulum();
+
+    /** Current grab for simulated proxies — the owner predicts its own */
+    UPROPERTY(ReplicatedUsing = OnRep_NetGrab)
+    FSwingNetGrab NetGrab;
+
+    UPROPERTY(ReplicatedUsing = OnRep_NetPendulum)
+    FSwingNetPendulum NetPendulum;
+
     UPROPERTY()
-    class ASwingPole* CurrentPole = nullptr;
+    class AActor* CurrentPole = nullptr;
 
     UPROPERTY()
     class ACharacter* OwnerCharacter = nullptr;
 
+    FSwingAnimSnapshot AnimSnapshot;
+
+    FSwingRecorder Recorder;
+
+    /** Jump was pressed since the last recorded sample */
+    bool bJumpSinceLastSample = false;
+
+    /** Walking slope lean, applied to the mesh relative to the upright actor */
+    FRotator SlopeLean      = FRotator::ZeroRotator;
+    FRotator GrabStartLean  = FRotator::ZeroRotator;
+    FQuat    BaseMeshRotation = FQuat::Identity;
+
+    /** Fires at the predicted intercept of a buffered grab */
+    FTimerHandle GrabBufferTimer;
+
     float   HangLength         = 120.0f;
     float   GrabAlpha          = 0.0f;
     FVector GrabStartLocation  = FVector::ZeroVector;
     FVector GrabTargetLocation = FVector::ZeroVector;
 
-    /** Actual frame-by-frame velocity during swing, used for launch */
+    /** Swing velocity used for launch: the frame-by-frame positional delta,
+     *  or the arc tangent of the sim state in fixed-step mode */
     FVector CachedSwingVelocity = FVector::ZeroVector;
 
+    /** Free part of the swing arc, found at grab time — the sim clamps to it */
+    float SwingMinAngle = -2.2f;
+    float SwingMaxAngle =  2.2f;
+
+    /** Rebound at each limit: FSwingPendulumKernel::ClampRestitution where an obstacle set it, 0 at ±MaxSwingAngle */
+    float SwingMinRestitution = 0.0f;
+    float SwingMaxRestitution = 0.0f;
+
+    /** Fixed-step mode: angle before the last step and unsimulated frame time */
+    float PrevSwingAngle       = 0.0f;
+    float FixedStepAccumulator = 0.0f;
+
     /** Saved BrakingDecelerationFalling to restore after post-release flight */
     float SavedBrakingDecelFalling = 0.0f;
     bool  bNeedsDecelRestore       = false;
+
+    /** Swing LOD for the per-component path — the batched path keeps its own */
+    FSwingLODState SwingLOD;
+    float          SignificanceTimer = 0.0f;
+
+    /** Slot in USwingSimulationSubsystem while batched, INDEX_NONE otherwise */
+    int32 SimIndex = INDEX_NONE;
+
+    /** True while USwingMovementComponent drives the swing */
+    bool bMovementDriven = false;
+
+    /** Id of this swing in USwingPhysicsSubsystem, INDEX_NONE when not physics-driven */
+    int32 PhysicsSwingId = INDEX_NONE;
+
+    /** Swing clock — seconds spent swinging since the grab transition ended */
+    float SwingTime = 0.0f;
+
+    /** ASwingPoleField entry of CurrentPole, INDEX_NONE for an ASwingPole */
+    int32 CurrentPoleInstance = INDEX_NONE;
+
+    /** Unit axis of CurrentPole */
+    FVector CurrentPoleDirection = FVector::RightVector;
+
+    uint8 GrabSequence = 0;
+
+    /** Server: CMC client error checks are off while a remote client swings */
+    bool bSavedIgnoreClientErrors = false;
+    bool bClientErrorsIgnored     = false;
+
+    /** Server: movement replication is off while swinging — NetGrab and NetPendulum carry the swing */
+    bool bSavedReplicateMovement    = false;
+    bool bMovementReplicationPaused = false;
+
+    /** Rendered minus simulated angle left by the last correction, fading to 0 */
+    float NetCorrectionOffset = 0.0f;
+
+    /** Owning client's predicted swing, one entry per update, for reconciliation */
+    struct FSwingNetHistoryEntry
+    {
+        float SwingTime;
+        float Angle;
+        float AngularVelocity;
+    };
+    TArray<FSwingNetHistoryEntry> NetHistory;
+
+    static constexpr int32 NetHistoryCapacity = 64;
+
+    /** Server state further ahead of the nearest prediction than this is not compared (ms) */
+    static constexpr int32 NetMatchWindowMs = 20;
+
+    /** Largest step used to replay or catch up a swing without a fixed rate */
+    static constexpr float MaxNetStep = 1.0f / 60.0f;
 };
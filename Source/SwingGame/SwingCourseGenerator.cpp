@@ -0,0 +1,120 @@
+#include "SwingCourseGenerator.h"
+#include "Async/ParallelFor.h"
+#include "Math/RandomStream.h"
+
+void FSwingCourseGenerator::Generate(const FSwingCourseSettings& Settings, int32 Seed, FSwingCourse& OutCourse)
+{
+    FRandomStream Random(Seed);
+
+    OutCourse.Seed            = Seed;
+    OutCourse.bValid          = false;
+    OutCourse.TotalFlightTime = 0.0f;
+    OutCourse.NarrowestWindow = 0.0f;
+    OutCourse.Poles.Reset(Settings.NumPoles);
+
+    const float MinHeight = FMath::Min(Settings.MinHeight, Settings.MaxHeight);
+    const float MaxHeight = FMath::Max(Settings.MinHeight, Settings.MaxHeight);
+
+    float X = 0.0f;
+    float Z = Random.FRandRange(MinHeight, MaxHeight);
+    for (int32 Index = 0; Index < FMath::Max(Settings.NumPoles, 2); ++Index)
+    {
+        if (Index > 0)
+        {
+            X += Random.FRandRange(Settings.MinSpacing, Settings.MaxSpacing);
+            Z = FMath::Clamp(
+                Z + Random.FRandRange(-Settings.MaxHeightStep, Settings.MaxHeightStep), MinHeight, MaxHeight);
+        }
+
+        FSwingCoursePole& Pole = OutCourse.Poles.AddDefaulted_GetRef();
+        Pole.Center     = FVector(X, Random.FRandRange(-Settings.MaxLateralOffset, Settings.MaxLateralOffset), Z);
+        Pole.HalfLength = Random.FRandRange(Settings.MinHalfLength, Settings.MaxHalfLength);
+    }
+}
+
+bool FSwingCourseGenerator::Validate(
+    FSwingCourse& Course, const FSwingCourseSettings& Settings, const FSwingReachTuning& Tuning)
+{
+    Course.bValid          = false;
+    Course.TotalFlightTime = 0.0f;
+    Course.NarrowestWindow = TNumericLimits<float>::Max();
+
+    auto MakeNode = [&Settings](const FSwingCoursePole& Pole)
+    {
+        // Placed unrotated — the pole axis is Y, as the swing expects
+        FSwingPoleGraphNode Node;
+        Node.Center     = Pole.Center;
+        Node.Direction  = FVector::RightVector;
+        Node.HalfLength = Pole.HalfLength;
+        Node.Reach      = Settings.PoleReach;
+        return Node;
+    };
+
+    // Each pole is held at the hang the flight into it grabs with
+    TArray<FSwingPoleGraphEdge> HopEdges;
+    FSwingPoleGraphNode Source = MakeNode(Course.Poles[0]);
+    float HangLength = Tuning.HangLength;
+    for (int32 Index = 1; Index < Course.Poles.Num(); ++Index)
+    {
+        const FSwingPoleGraphNode Target = MakeNode(Course.Poles[Index]);
+
+        HopEdges.Reset();
+        ASwingPoleGraph::BakeEdges(Source, Target, Index, Tuning, HangLength, Settings.ReleaseSamples, HopEdges);
+
+        // The widest forward window is the release a player would aim for
+        const FSwingPoleGraphEdge* Best = nullptr;
+        for (const FSwingPoleGraphEdge& Edge : HopEdges)
+        {
+            if (Edge.Direction > 0 && (!Best ||
+                Edge.MaxReleaseAngle - Edge.MinReleaseAngle > Best->MaxReleaseAngle - Best->MinReleaseAngle))
+            {
+                Best = &Edge;
+            }
+        }
+
+        const float Window = Best ? Best->MaxReleaseAngle - Best->MinReleaseAngle : 0.0f;
+        if (!Best || Window < Settings.MinReleaseWindow) return false;
+
+        Course.TotalFlightTime += Best->FlightTime;
+        Course.NarrowestWindow  = FMath::Min(Course.NarrowestWindow, Window);
+        Source     = Target;
+        HangLength = Best->ArrivalHangLength;
+    }
+
+    Course.bValid = true;
+    return true;
+}
+
+void FSwingCourseGenerator::GenerateBatch(
+    const FSwingCourseSettings& Settings, const FSwingReachTuning& Tuning,
+    int32 FirstSeed, int32 NumCandidates, TArray<FSwingCourse>& OutAccepted)
+{
+    OutAccepted.Reset();
+    if (NumCandidates <= 0) return;
+
+    constexpr int32 BatchSize = 64;
+
+    TArray<FSwingCourse> Candidates;
+    Candidates.SetNum(NumCandidates);
+
+    const int32 NumBatches = FMath::DivideAndRoundUp(NumCandidates, BatchSize);
+    ParallelFor(NumBatches, [&](int32 Batch)
+    {
+        const int32 Start = Batch * BatchSize;
+        const int32 End   = FMath::Min(Start + BatchSize, NumCandidates);
+
+        for (int32 Index = Start; Index < End; ++Index)
+        {
+            FSwingCourse& Course = Candidates[Index];
+            Generate(Settings, FirstSeed + Index, Course);
+            if (!Validate(Course, Settings, Tuning))
+                Course.Poles.Empty();
+        }
+    });
+
+    for (FSwingCourse& Course : Candidates)
+    {
+        if (Course.bValid)
+            OutAccepted.Add(MoveTemp(Course));
+    }
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SwingPoleGraph.h"
+#include "SwingCourseGenerator.generated.h"
+
+/** Ranges a generated course is drawn from. Courses run along +X, the swing plane. */
+USTRUCT(BlueprintType)
+struct SWINGGAME_API FSwingCourseSettings
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Course", meta = (ClampMin = 2))
+    int32 NumPoles = 12;
+
+    /** Distance along X between consecutive pole centres (cm) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Course", meta = (ClampMin = 0))
+    float MinSpacing = 250.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Course", meta = (ClampMin = 0))
+    float MaxSpacing = 700.0f;
+
+    /** Pole height above the course origin (cm) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Course")
+    float MinHeight = 250.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Course")
+    float MaxHeight = 700.0f;
+
+    /** Largest height change from one pole to the next (cm) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Course", meta = (ClampMin = 0))
+    float MaxHeightStep = 150.0f;
+
+    /** Sideways offset of each pole — flight stays in XZ, so keep it within grab reach (cm) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Course", meta = (ClampMin = 0))
+    float MaxLateralOffset = 50.0f;
+
+    /** ASwingPole::PoleHalfLength range (cm) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Course", meta = (ClampMin = 0))
+    float MinHalfLength = 75.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Course", meta = (ClampMin = 0))
+    float MaxHalfLength = 200.0f;
+
+    /** Grab reach of the pole class that will be placed — ASwingPole's GrabTrigger radius (cm) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Validation", meta = (ClampMin = 0))
+    float PoleReach = 200.0f;
+
+    /** Narrowest release window a hop may have — rejects pixel-perfect jumps (rad) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Validation", meta = (ClampMin = 0))
+    float MinReleaseWindow = 0.15f;
+
+    /** Release angles tried across the arc per hop */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Validation", meta = (ClampMin = 8))
+    int32 ReleaseSamples = 32;
+};
+
+USTRUCT(BlueprintType)
+struct SWINGGAME_API FSwingCoursePole
+{
+    GENERATED_BODY()
+
+    /** Relative to the course origin */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Course")
+    FVector Center = FVector::ZeroVector;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Course")
+    float HalfLength = 150.0f;
+};
+
+USTRUCT(BlueprintType)
+struct SWINGGAME_API FSwingCourse
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Course")
+    int32 Seed = 0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Course")
+    TArray<FSwingCoursePole> Poles;
+
+    /** Set by validation: every hop reachable with a wide enough window */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Course")
+    bool bValid = false;
+
+    /** Sum of the hops' flight times (s) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Course")
+    float TotalFlightTime = 0.0f;
+
+    /** Narrowest release window of any hop (rad) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Course")
+    float NarrowestWindow = 0.0f;
+};
+
+/**
+ * Seeded swing-course generation with analytic validation.
+ *
+ * Every hop is checked with ASwingPoleGraph::BakeEdges — steady pumped swing in
+ * closed form, ballistic release — the same math the AI graph is baked with, so
+ * no physics runs. Hops must be made swinging forward (+X). The first pole is held
+ * at Tuning.HangLength, every later one at the hang its incoming flight grabs
+ * with. Touches no UObjects, so candidates validate in parallel on worker threads.
+ */
+struct SWINGGAME_API FSwingCourseGenerator
+{
+    /** Draws a course from Settings. The same seed always gives the same course. */
+    static void Generate(const FSwingCourseSettings& Settings, int32 Seed, FSwingCourse& OutCourse);
+
+    /** Validates every hop in order, stopping at the first failure. Returns Course.bValid. */
+    static bool Validate(FSwingCourse& Course, const FSwingCourseSettings& Settings, const FSwingReachTuning& Tuning);
+
+    /**
+     * Generates and validates seeds [FirstSeed, FirstSeed + NumCandidates) in parallel.
+     * OutAccepted receives the valid courses in seed order.
+     */
+    static void GenerateBatch(
+        const FSwingCourseSettings& Settings, const FSwingReachTuning& Tuning,
+        int32 FirstSeed, int32 NumCandidates, TArray<FSwingCourse>& OutAccepted);
+};
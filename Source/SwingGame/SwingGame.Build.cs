@@ -12,6 +12,11 @@ public class SwingGame : ModuleRules
 			"Core",
 			"CoreUObject",
 			"Engine",
+			"RenderCore",
+			"Chaos",
+			"PhysicsCore",
+			"AnimGraphRuntime",
+			"AnimationCore",
 			"InputCore",
 			"EnhancedInput",
 			"AIModule",
@@ -25,6 +30,7 @@ public class SwingGame : ModuleRules
 
 		PublicIncludePaths.AddRange(new string[] {
 			"SwingGame",
+			"SwingGame/AI",
 			"SwingGame/Variant_Platforming",
 			"SwingGame/Variant_Platforming/Animation",
 			"SwingGame/Variant_Combat",
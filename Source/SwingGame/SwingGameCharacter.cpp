@@ -12,8 +12,11 @@
 #include "InputActionValue.h"
 #include "SwingGame.h"
 #include "SwingComponent.h"
+#include "SwingMovementComponent.h"
+#include "SwingStreamingSourceComponent.h"
 
-ASwingGameCharacter::ASwingGameCharacter()
+ASwingGameCharacter::ASwingGameCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<USwingMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
 	// Set size for collision capsule
 	GetCapsuleComponent()->InitCapsuleSize(42.f, 96.0f);
@@ -52,6 +55,9 @@ ASwingGameCharacter::ASwingGameCharacter()
 
 	// Swing mechanic component
 	SwingComponent = CreateDefaultSubobject<USwingComponent>(TEXT("SwingComponent"));
+
+	// Predictive streaming for fast swing chains
+	SwingStreamingSource = CreateDefaultSubobject<USwingStreamingSourceComponent>(TEXT("SwingStreamingSource"));
 }
 
 void ASwingGameCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
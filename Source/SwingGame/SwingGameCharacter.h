@@ -11,6 +11,7 @@ class USpringArmComponent;
 class UCameraComponent;
 class UInputAction;
 class USwingComponent;
+class USwingStreamingSourceComponent;
 struct FInputActionValue;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogTemplateCharacter, Log, All);
@@ -36,6 +37,10 @@ class ASwingGameCharacter : public ACharacter
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components", meta = (AllowPrivateAccess = "true"))
 	USwingComponent* SwingComponent;
 
+	/** Streams in World Partition cells around predicted swing landings */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components", meta = (AllowPrivateAccess = "true"))
+	USwingStreamingSourceComponent* SwingStreamingSource;
+
 protected:
 
 	/** Jump Input Action */
@@ -57,7 +62,7 @@ protected:
 public:
 
 	/** Constructor */
-	ASwingGameCharacter();	
+	ASwingGameCharacter(const FObjectInitializer& ObjectInitializer);
 
 protected:
 
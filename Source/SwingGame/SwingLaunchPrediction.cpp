@@ -0,0 +1,31 @@
+#include "SwingLaunchPrediction.h"
+
+FSwingLaunchPrediction FSwingLaunchPrediction::Predict(
+    const FVector& Pivot, float HangLength, float Angle, float AngularVelocity,
+    float LaunchSpeedMultiplier, float InGravity, float LandingZ)
+{
+    FSwingLaunchPrediction Result;
+    Result.Gravity = InGravity;
+
+    float Sin, Cos;
+    FMath::SinCos(&Sin, &Cos, Angle);
+
+    // Hang point and its velocity along the arc
+    Result.LaunchLocation = Pivot + FVector(Sin, 0.0f, -Cos) * HangLength;
+    Result.LaunchVelocity = FVector(Cos, 0.0f, Sin) * (HangLength * AngularVelocity * LaunchSpeedMultiplier);
+
+    if (InGravity <= KINDA_SMALL_NUMBER) return Result;
+
+    // z(t) = z0 + vz·t - ½·g·t²  →  later root of z(t) = LandingZ
+    const float Vz   = Result.LaunchVelocity.Z;
+    const float Disc = Vz * Vz + 2.0f * InGravity * (Result.LaunchLocation.Z - LandingZ);
+    if (Disc < 0.0f) return Result;  // apex is below the landing plane
+
+    Result.TimeOfFlight    = (Vz + FMath::Sqrt(Disc)) / InGravity;
+    Result.LandingLocation = Result.GetLocationAtTime(Result.TimeOfFlight);
+    Result.bValid          = Result.TimeOfFlight >= 0.0f;
+
+    // Snap away float error so callers can compare against the plane exactly
+    Result.LandingLocation.Z = LandingZ;
+    return Result;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SwingLaunchPrediction.generated.h"
+
+/**
+ * Closed-form ballistic flight of a swing release.
+ * After Release() the character flies with gravity only — launch overrides
+ * velocity and BrakingDecelerationFalling is 0 — so the arc is an exact parabola.
+ */
+USTRUCT(BlueprintType)
+struct SWINGGAME_API FSwingLaunchPrediction
+{
+    GENERATED_BODY()
+
+    /** False when the arc never comes down to the landing height */
+    UPROPERTY(BlueprintReadOnly, Category = "Swing|Prediction")
+    bool bValid = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Swing|Prediction")
+    FVector LaunchLocation = FVector::ZeroVector;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Swing|Prediction")
+    FVector LaunchVelocity = FVector::ZeroVector;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Swing|Prediction")
+    FVector LandingLocation = FVector::ZeroVector;
+
+    /** Seconds from release to reaching the landing height */
+    UPROPERTY(BlueprintReadOnly, Category = "Swing|Prediction")
+    float TimeOfFlight = 0.0f;
+
+    /** Downward gravity magnitude the arc was computed with (cm/s²) */
+    UPROPERTY(BlueprintReadOnly, Category = "Swing|Prediction")
+    float Gravity = 0.0f;
+
+    /** Point on the arc Time seconds after release — handy for drawing UI arcs */
+    FVector GetLocationAtTime(float Time) const
+    {
+        return LaunchLocation + LaunchVelocity * Time - FVector(0.0f, 0.0f, 0.5f * Gravity * Time * Time);
+    }
+
+    /**
+     * Predicts the flight for a release from the given pendulum state.
+     * @param InGravity downward acceleration magnitude (positive, cm/s²)
+     * @param LandingZ  world height of the landing plane
+     */
+    static FSwingLaunchPrediction Predict(
+        const FVector& Pivot, float HangLength, float Angle, float AngularVelocity,
+        float LaunchSpeedMultiplier, float InGravity, float LandingZ);
+};
@@ -0,0 +1,71 @@
+#include "SwingMovementComponent.h"
+#include "SwingComponent.h"
+#include "SwingStats.h"
+
+void USwingMovementComponent::StartSwing(USwingComponent* Swinger)
+{
+    ActiveSwinger = Swinger;
+    SetMovementMode(MOVE_Custom, static_cast<uint8>(ESwingCustomMovementMode::Swing));
+}
+
+void USwingMovementComponent::StopSwing()
+{
+    const bool bWasSwinging = IsSwinging();
+    ActiveSwinger = nullptr;
+
+    if (bWasSwinging) SetMovementMode(MOVE_Falling);
+}
+
+bool USwingMovementComponent::IsSwinging() const
+{
+    return MovementMode == MOVE_Custom
+        && CustomMovementMode == static_cast<uint8>(ESwingCustomMovementMode::Swing);
+}
+
+void USwingMovementComponent::PhysCustom(float DeltaTime, int32 Iterations)
+{
+    if (CustomMovementMode == static_cast<uint8>(ESwingCustomMovementMode::Swing))
+    {
+        PhysSwing(DeltaTime);
+        return;
+    }
+
+    Super::PhysCustom(DeltaTime, Iterations);
+}
+
+void USwingMovementComponent::PhysSwing(float DeltaTime)
+{
+    if (DeltaTime < MIN_TICK_TIME) return;
+
+    if (!ActiveSwinger || !IsValid(ActiveSwinger))
+    {
+        ActiveSwinger = nullptr;
+        SetMovementMode(MOVE_Falling);
+        return;
+    }
+
+    const FVector  OldLocation = UpdatedComponent->GetComponentLocation();
+    const FVector  NewLocation = ActiveSwinger->BlendNetCorrection(ActiveSwinger->AdvanceSwing(DeltaTime), DeltaTime);
+    const FRotator NewRotation = ActiveSwinger->GetSwingFacing(DeltaTime);
+    const FVector  Delta       = NewLocation - OldLocation;
+
+    // The pendulum's own velocity, so release and anim see the arc tangent
+    Velocity = ActiveSwinger->CachedSwingVelocity;
+
+    // One swept move for position and facing
+    FHitResult Hit;
+    SafeMoveUpdatedComponent(Delta, NewRotation.Quaternion(), true, Hit);
+    ++FSwingStats::TransformUpdates;
+    ++FSwingStats::SceneQueries;  // the move sweeps the capsule
+
+    if (Hit.IsValidBlockingHit())
+    {
+        SlideAlongSurface(Delta, 1.0f - Hit.Time, Hit.Normal, Hit, true);
+
+        // Feed the slide back so the next step starts here, not inside the wall
+        ActiveSwinger->ResolveBlockedSwing(UpdatedComponent->GetComponentLocation(), OldLocation, DeltaTime);
+        Velocity = ActiveSwinger->CachedSwingVelocity;
+    }
+
+    ActiveSwinger->FinishSwingUpdate(DeltaTime);
+}
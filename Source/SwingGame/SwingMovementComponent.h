@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "SwingMovementComponent.generated.h"
+
+class USwingComponent;
+
+/** Custom movement modes of USwingMovementComponent (MOVE_Custom sub-modes) */
+UENUM(BlueprintType)
+enum class ESwingCustomMovementMode : uint8
+{
+    Swing = 0
+};
+
+/**
+ * Character movement with a native swing mode.
+ * With USwingComponent::SimulationMode set to Movement, the pendulum is stepped
+ * inside PhysCustom and the character is moved by a single swept
+ * SafeMoveUpdatedComponent, so swinging goes through the regular movement
+ * pipeline (collision, base tracking, root motion rules) instead of a teleport.
+ *
+ * Swing moves are not saved moves: the pendulum state is not part of
+ * FSavedMove_Character, so the CMC never replays or corrects a swing. Networked
+ * swings are reconciled by USwingComponent against its replicated pendulum state.
+ */
+UCLASS()
+class SWINGGAME_API USwingMovementComponent : public UCharacterMovementComponent
+{
+    GENERATED_BODY()
+
+public:
+    /** Enters the swing mode, driven by Swinger until StopSwing */
+    void StartSwing(USwingComponent* Swinger);
+
+    /** Leaves the swing mode — falls if the character is still in it */
+    void StopSwing();
+
+    bool IsSwinging() const;
+
+protected:
+    virtual void PhysCustom(float DeltaTime, int32 Iterations) override;
+
+private:
+    void PhysSwing(float DeltaTime);
+
+    UPROPERTY(Transient)
+    TObjectPtr<USwingComponent> ActiveSwinger;
+};
@@ -0,0 +1,96 @@
+#include "SwingNetState.h"
+#include "GameFramework/Actor.h"
+#include "UObject/CoreNet.h"
+
+namespace
+{
+    int16 QuantizeSigned(float Value, float Range)
+    {
+        return static_cast<int16>(FMath::RoundToInt(FMath::Clamp(Value / Range, -1.0f, 1.0f) * MAX_int16));
+    }
+
+    float DequantizeSigned(int16 Value, float Range)
+    {
+        return Value * (Range / MAX_int16);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Grab
+// ---------------------------------------------------------------------------
+
+float FSwingNetGrab::GetStartAngle() const
+{
+    return DequantizeSigned(StartAngle, UE_PI);
+}
+
+void FSwingNetGrab::Set(AActor* InPole, int32 InInstanceIndex, float InPivotOffset, float InHangLength, float InStartAngle)
+{
+    Pole          = InPole;
+    InstanceIndex = InInstanceIndex == INDEX_NONE ? MAX_uint16 : static_cast<uint16>(InInstanceIndex);
+    PivotOffset   = static_cast<int16>(FMath::Clamp(FMath::RoundToInt(InPivotOffset * 2.0f), MIN_int16, MAX_int16));
+    HangLength    = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(InHangLength * 10.0f), 0, MAX_uint16));
+    StartAngle    = QuantizeSigned(InStartAngle, UE_PI);
+}
+
+bool FSwingNetGrab::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    bOutSuccess = true;
+
+    uint8 bGrabbed = Ar.IsSaving() && IsGrabbed();
+    Ar.SerializeBits(&bGrabbed, 1);
+    Ar << Sequence;
+
+    if (!bGrabbed)
+    {
+        if (Ar.IsLoading()) Pole = nullptr;
+        return true;
+    }
+
+    UObject* PoleObject = Pole;
+    bOutSuccess &= Map->SerializeObject(Ar, AActor::StaticClass(), PoleObject);
+    if (Ar.IsLoading()) Pole = Cast<AActor>(PoleObject);
+
+    uint8 bHasInstance = InstanceIndex != MAX_uint16;
+    Ar.SerializeBits(&bHasInstance, 1);
+    if (bHasInstance)
+        Ar << InstanceIndex;
+    else if (Ar.IsLoading())
+        InstanceIndex = MAX_uint16;
+
+    Ar << PivotOffset << HangLength << StartAngle;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Pendulum
+// ---------------------------------------------------------------------------
+
+float FSwingNetPendulum::GetAngle() const
+{
+    return DequantizeSigned(Angle, UE_PI);
+}
+
+float FSwingNetPendulum::GetAngularVelocity() const
+{
+    return DequantizeSigned(AngularVelocity, MaxAngularVelocity);
+}
+
+void FSwingNetPendulum::Set(float InAngle, float InAngularVelocity, float InSwingTime)
+{
+    Angle           = QuantizeSigned(InAngle, UE_PI);
+    AngularVelocity = QuantizeSigned(InAngularVelocity, MaxAngularVelocity);
+    SwingTime       = QuantizeSwingTime(InSwingTime);
+}
+
+uint16 FSwingNetPendulum::QuantizeSwingTime(float InSwingTime)
+{
+    return static_cast<uint16>(static_cast<int64>(FMath::RoundToDouble(InSwingTime * 1000.0)) & MAX_uint16);
+}
+
+bool FSwingNetPendulum::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    Ar << Angle << AngularVelocity << SwingTime;
+    bOutSuccess = true;
+    return true;
+}
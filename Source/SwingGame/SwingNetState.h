@@ -0,0 +1,94 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SwingNetState.generated.h"
+
+/**
+ * Current grab as replicated to simulated proxies, and sent to the server by the
+ * owning client. The pivot travels as the pole's net reference plus a quantized
+ * offset along it; only sent when a grab starts or ends.
+ */
+USTRUCT()
+struct SWINGGAME_API FSwingNetGrab
+{
+    GENERATED_BODY()
+
+    /** ASwingPole or ASwingPoleField grabbed, null once released */
+    UPROPERTY()
+    TObjectPtr<AActor> Pole;
+
+    /** Entry of an ASwingPoleField, MAX_uint16 for an ASwingPole */
+    UPROPERTY()
+    uint16 InstanceIndex = MAX_uint16;
+
+    /** Pivot along the pole axis from its centre, 0.5 cm steps */
+    UPROPERTY()
+    int16 PivotOffset = 0;
+
+    /** 0.1 cm steps */
+    UPROPERTY()
+    uint16 HangLength = 0;
+
+    UPROPERTY()
+    int16 StartAngle = 0;
+
+    /** Bumped by the grabbing side on every grab, so rejections and re-grabs of the same pole are told apart */
+    UPROPERTY()
+    uint8 Sequence = 0;
+
+    bool IsGrabbed() const { return Pole != nullptr; }
+
+    float GetPivotOffset() const { return PivotOffset * 0.5f; }
+    float GetHangLength() const  { return HangLength * 0.1f; }
+    float GetStartAngle() const;
+
+    void Set(AActor* InPole, int32 InInstanceIndex, float InPivotOffset, float InHangLength, float InStartAngle);
+
+    bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FSwingNetGrab> : public TStructOpsTypeTraitsBase2<FSwingNetGrab>
+{
+    enum { WithNetSerializer = true };
+};
+
+/**
+ * Pendulum state the server replicates every swing update — 6 bytes on the wire.
+ * SwingTime is the swing's own clock (seconds since it started swinging) in
+ * milliseconds, wrapping every 65.5 s; the owning client matches it against its
+ * prediction history.
+ */
+USTRUCT()
+struct SWINGGAME_API FSwingNetPendulum
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    int16 Angle = 0;
+
+    UPROPERTY()
+    int16 AngularVelocity = 0;
+
+    UPROPERTY()
+    uint16 SwingTime = 0;
+
+    /** Angular speed covered by the quantization (rad/s) */
+    static constexpr float MaxAngularVelocity = 32.0f;
+
+    float GetAngle() const;
+    float GetAngularVelocity() const;
+
+    void Set(float InAngle, float InAngularVelocity, float InSwingTime);
+
+    /** Swing clock in the wire format */
+    static uint16 QuantizeSwingTime(float InSwingTime);
+
+    bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FSwingNetPendulum> : public TStructOpsTypeTraitsBase2<FSwingNetPendulum>
+{
+    enum { WithNetSerializer = true };
+};
@@ -0,0 +1,150 @@
+#include "SwingPendulumEnvelope.h"
+#include "SwingSimulationSubsystem.h"
+
+void FSwingPendulumEnvelope::Seed(
+    float Angle, float AngularVelocity,
+    float HangLength, float AutoSwingForce, float Damping, float InMaxAngle)
+{
+    constexpr float G = 980.0f;
+    GravityOverLength = G / FMath::Max(HangLength, 1.0f);
+    MaxAngle          = InMaxAngle;
+
+    // Damping scales ω by Damping^(60·dt) → dω/dt = -k·ω with k = -60·ln(Damping).
+    // Averaged over a cycle of ω = V·cos φ: dV/dt = -k/2·V + 2F/π
+    const float K = -60.0f * FMath::Loge(FMath::Clamp(Damping, KINDA_SMALL_NUMBER, 1.0f));
+    Decay            = 0.5f * K;
+    PumpRate         = 2.0f * AutoSwingForce / UE_PI;
+    EquilibriumSpeed = Decay > KINDA_SMALL_NUMBER ? PumpRate / Decay : 0.0f;
+
+    // Energy per unit (m·L²): ½ω² + (g/L)(1 - cos θ) = ½V²
+    const float Energy = 0.5f * AngularVelocity * AngularVelocity
+        + GravityOverLength * (1.0f - FMath::Cos(Angle));
+    PeakSpeed = FMath::Sqrt(2.0f * Energy);
+
+    // θ = A·sin φ, ω = A·Ω·cos φ
+    const float Omega = GetFrequency(GetAmplitude(PeakSpeed));
+    Phase = FMath::Atan2(Angle * Omega, AngularVelocity);
+}
+
+void FSwingPendulumEnvelope::Advance(float DeltaTime)
+{
+    if (DeltaTime <= 0.0f) return;
+
+    const float OmegaBefore = GetFrequency(GetAmplitude(PeakSpeed));
+
+    if (Decay > KINDA_SMALL_NUMBER)
+    {
+        PeakSpeed = EquilibriumSpeed
+            + (PeakSpeed - EquilibriumSpeed) * FMath::Exp(-Decay * DeltaTime);
+    }
+    else
+    {
+        PeakSpeed += PumpRate * DeltaTime;
+    }
+
+    const float OmegaAfter = GetFrequency(GetAmplitude(PeakSpeed));
+
+    Phase = FMath::Fmod(Phase + 0.5f * (OmegaBefore + OmegaAfter) * DeltaTime, UE_TWO_PI);
+}
+
+void FSwingPendulumEnvelope::Evaluate(float& OutAngle, float& OutAngularVelocity) const
+{
+    const float Amplitude = GetAmplitude(PeakSpeed);
+    const float Omega     = GetFrequency(Amplitude);
+
+    float Sin, Cos;
+    FMath::SinCos(&Sin, &Cos, Phase);
+
+    OutAngle           = Amplitude * Sin;
+    OutAngularVelocity = Amplitude * Omega * Cos;
+}
+
+float FSwingPendulumEnvelope::GetAmplitude(float Speed) const
+{
+    // ½V² = (g/L)(1 - cos A)
+    const float CosAmplitude = 1.0f - (Speed * Speed) / (2.0f * GravityOverLength);
+    const float Amplitude    = CosAmplitude <= -1.0f ? UE_PI : FMath::Acos(CosAmplitude);
+    return FMath::Min(Amplitude, MaxAngle);
+}
+
+float FSwingPendulumEnvelope::GetFrequency(float Amplitude) const
+{
+    // Exact nonlinear period: T = 2π·sqrt(L/g) / AGM(1, cos(A/2))
+    float A = 1.0f;
+    float B = FMath::Cos(0.5f * Amplitude);
+    for (int32 Iteration = 0; Iteration < 4; ++Iteration)
+    {
+        const float Mean = 0.5f * (A + B);
+        B = FMath::Sqrt(A * B);
+        A = Mean;
+    }
+    return FMath::Sqrt(GravityOverLength) * A;
+}
+
+// ---------------------------------------------------------------------------
+// LOD state
+// ---------------------------------------------------------------------------
+
+void FSwingLODState::Enter(
+    float Angle, float AngularVelocity,
+    float InHangLength, float InAutoSwingForce, float InDamping,
+    float InMinAngle, float InMaxAngle, float InMinRestitution, float InMaxRestitution,
+    float InStep)
+{
+    SeedAngle           = Angle;
+    SeedAngularVelocity = AngularVelocity;
+    HangLength          = InHangLength;
+    AutoSwingForce      = InAutoSwingForce;
+    Damping             = InDamping;
+    MinAngle            = InMinAngle;
+    MaxAngle            = InMaxAngle;
+    MinRestitution      = InMinRestitution;
+    MaxRestitution      = InMaxRestitution;
+    Step                = InStep;
+    Elapsed             = 0.0f;
+    bActive             = true;
+
+    // The envelope is symmetric — bound it by the nearer limit, Advance clamps the rest
+    Envelope.Seed(Angle, AngularVelocity, HangLength, AutoSwingForce, Damping,
+                  FMath::Max(FMath::Min(-MinAngle, MaxAngle), 0.0f));
+}
+
+void FSwingLODState::Advance(float DeltaTime, float& OutAngle, float& OutAngularVelocity)
+{
+    Elapsed += DeltaTime;
+    Envelope.Advance(DeltaTime);
+    Envelope.Evaluate(OutAngle, OutAngularVelocity);
+    OutAngle = FMath::Clamp(OutAngle, MinAngle, MaxAngle);
+}
+
+void FSwingLODState::Exit(float& OutAngle, float& OutAngularVelocity)
+{
+    bActive = false;
+
+    // Bounded work on exit: a swinger culled for long keeps the closed form
+    const int64 Steps = Step > 0.0f ? FMath::FloorToInt64(Elapsed / Step) : MAX_int64;
+    if (Steps > MaxCatchUpSteps)
+    {
+        Envelope.Evaluate(OutAngle, OutAngularVelocity);
+        OutAngle = FMath::Clamp(OutAngle, MinAngle, MaxAngle);
+        return;
+    }
+
+    OutAngle           = SeedAngle;
+    OutAngularVelocity = SeedAngularVelocity;
+
+    const float Remainder = Elapsed - Steps * Step;
+
+    for (int64 Index = 0; Index < Steps; ++Index)
+    {
+        USwingSimulationSubsystem::StepPendulum(
+            OutAngle, OutAngularVelocity,
+            HangLength, AutoSwingForce, Damping, MinAngle, MaxAngle, Step, MinRestitution, MaxRestitution);
+    }
+    if (Remainder > KINDA_SMALL_NUMBER)
+    {
+        USwingSimulationSubsystem::StepPendulum(
+            OutAngle, OutAngularVelocity,
+            HangLength, AutoSwingForce, Damping, MinAngle, MaxAngle, Remainder, MinRestitution, MaxRestitution);
+    }
+}
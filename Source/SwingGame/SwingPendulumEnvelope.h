@@ -0,0 +1,92 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Closed-form stand-in for the pumped, damped pendulum, used by swing LOD.
+ *
+ * Motion is an undamped oscillation θ = A·sin φ. The peak angular speed relaxes
+ * exponentially toward the level where AutoSwingForce pumping balances
+ * SwingDamping (cycle-averaged energy balance), and the amplitude follows from
+ * that speed through energy conservation. Advancing by any time span costs the
+ * same, so insignificant swingers can be evaluated a few times a second and still
+ * be roughly at the right point of their swing. Its phase drifts from the real
+ * simulation over time — FSwingLODState replays the exact integrator whenever
+ * the result matters again.
+ */
+struct SWINGGAME_API FSwingPendulumEnvelope
+{
+    /** Captures the current pendulum state and tuning */
+    void Seed(float Angle, float AngularVelocity,
+              float HangLength, float AutoSwingForce, float Damping, float MaxAngle);
+
+    /** Moves the envelope and phase forward by DeltaTime seconds */
+    void Advance(float DeltaTime);
+
+    void Evaluate(float& OutAngle, float& OutAngularVelocity) const;
+
+private:
+    float GetAmplitude(float Speed) const;
+    float GetFrequency(float Amplitude) const;
+
+    /** Angular speed at the bottom of the swing (rad/s) */
+    float PeakSpeed = 0.0f;
+
+    /** Peak speed where pumping and damping cancel out */
+    float EquilibriumSpeed = 0.0f;
+
+    /** Relaxation rate of PeakSpeed toward EquilibriumSpeed (1/s) */
+    float Decay = 0.0f;
+
+    /** Average peak speed gain from pumping (rad/s²) */
+    float PumpRate = 0.0f;
+
+    float Phase             = 0.0f;
+    float GravityOverLength = 0.0f;
+    float MaxAngle          = 0.0f;
+};
+
+/**
+ * Swing LOD bookkeeping shared by the batched and per-component paths.
+ * While active, the swinger is only evaluated through the envelope. Leaving LOD
+ * replays the time spent in it with the full integrator at the swinger's own step
+ * from the state LOD was entered with, so the swing continues where a fully
+ * simulated one would be. Replays longer than MaxCatchUpSteps keep the envelope.
+ */
+struct SWINGGAME_API FSwingLODState
+{
+    bool IsActive() const { return bActive; }
+
+    /** InStep is the step the swinger integrates with — its fixed step, or the current frame time */
+    void Enter(float Angle, float AngularVelocity,
+               float InHangLength, float InAutoSwingForce, float InDamping,
+               float InMinAngle, float InMaxAngle, float InMinRestitution, float InMaxRestitution,
+               float InStep);
+
+    /** Advances the closed-form estimate by DeltaTime and returns it */
+    void Advance(float DeltaTime, float& OutAngle, float& OutAngularVelocity);
+
+    /** Leaves LOD and returns the caught-up pendulum state */
+    void Exit(float& OutAngle, float& OutAngularVelocity);
+
+    /** Most steps replayed on exit — beyond it the envelope estimate is kept */
+    static constexpr int32 MaxCatchUpSteps = 600;
+
+private:
+    FSwingPendulumEnvelope Envelope;
+
+    float SeedAngle           = 0.0f;
+    float SeedAngularVelocity = 0.0f;
+    float HangLength          = 0.0f;
+    float AutoSwingForce      = 0.0f;
+    float Damping             = 0.0f;
+    float MinAngle            = 0.0f;
+    float MaxAngle            = 0.0f;
+    float MinRestitution      = 0.0f;
+    float MaxRestitution      = 0.0f;
+    float Step                = 0.0f;
+
+    /** Time spent in LOD so far */
+    float Elapsed = 0.0f;
+    bool  bActive = false;
+};
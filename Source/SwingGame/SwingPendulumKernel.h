@@ -0,0 +1,365 @@
+#pragma once
+
+// Engine-independent on purpose: no Core includes, so the pendulum math can be
+// compiled into tools and benchmarks on its own.
+#include <algorithm>
+#include <cmath>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define SWING_KERNEL_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define SWING_KERNEL_SSE2 1
+#elif (defined(__ARM_NEON) || defined(_M_ARM64)) && (defined(__aarch64__) || defined(_M_ARM64))
+    #include <arm_neon.h>
+    #define SWING_KERNEL_NEON 1
+#endif
+
+/**
+ * Swing pendulum step: gravity, AutoSwingForce pumping, frame-rate independent
+ * damping and the angle clamp.
+ *
+ * Step is the exact single-pendulum integrator (USwingSimulationSubsystem::StepPendulum
+ * forwards to it). StepBatch advances structure-of-arrays state with the widest
+ * SIMD path the build targets (AVX2, SSE2 or NEON; scalar otherwise) and replaces
+ * sin / pow with polynomials — it agrees with Step to about 1e-6 relative per step
+ * but is not bit-identical. USwingSimulationSubsystem runs every swinger through it.
+ */
+struct FSwingPendulumKernel
+{
+    static constexpr float Gravity       = 980.0f;
+    static constexpr float PumpThreshold = 0.05f;
+
+    /** Share of angular speed kept, reversed, when the swing hits a limit set by an obstacle */
+    static constexpr float ClampRestitution = 0.3f;
+
+    static inline float Sign(float Value)
+    {
+        return Value > 0.0f ? 1.0f : (Value < 0.0f ? -1.0f : 0.0f);
+    }
+
+    /**
+     * MinRestitution / MaxRestitution: share of angular speed kept, reversed, at that limit.
+     * 0 (the plain arc limit) clamps the angle and leaves the speed for gravity to turn around.
+     */
+    static inline void Step(
+        float& Angle, float& AngularVelocity,
+        float HangLength, float AutoSwingForce, float Damping, float MinAngle, float MaxAngle,
+        float DeltaTime, float MinRestitution = 0.0f, float MaxRestitution = 0.0f)
+    {
+        // α = -(g / L) * sin(θ)
+        const float Alpha = -(Gravity / HangLength) * std::sin(Angle);
+
+        AngularVelocity += Alpha * DeltaTime;
+
+        // Auto-swing: pump energy in the direction of current motion.
+        // When nearly stationary, push away from equilibrium based on angle.
+        const float Dir = std::fabs(AngularVelocity) > PumpThreshold
+            ? Sign(AngularVelocity)
+            : Sign(Angle);
+        AngularVelocity += Dir * AutoSwingForce * DeltaTime;
+
+        AngularVelocity *= std::pow(Damping, DeltaTime * 60.0f);
+
+        // Bounce off an obstacle limit so the swing comes back instead of pinning against it
+        const float Unclamped = Angle + AngularVelocity * DeltaTime;
+        if (Unclamped > MaxAngle && MaxRestitution > 0.0f)
+            AngularVelocity = -MaxRestitution * std::fabs(AngularVelocity);
+        else if (Unclamped < MinAngle && MinRestitution > 0.0f)
+            AngularVelocity = MinRestitution * std::fabs(AngularVelocity);
+
+        Angle = std::min(std::max(Unclamped, MinAngle), MaxAngle);
+    }
+
+    /** Batched damping input: log2(Damping), computed once per pendulum */
+    static inline float GetDampingLog2(float Damping)
+    {
+        return std::log2(Damping);
+    }
+
+    /**
+     * Steps Count pendulums, each by its own DeltaTimes entry (0 leaves it untouched).
+     * Angles must stay within ±π (true for any MaxSwingAngle up to π).
+     * DampingLog2s holds GetDampingLog2(Damping) per pendulum; restitutions are as in Step.
+     */
+    static inline void StepBatch(
+        float* Angles, float* AngularVelocities,
+        const float* HangLengths, const float* AutoSwingForces, const float* DampingLog2s,
+        const float* MinAngles, const float* MaxAngles,
+        const float* MinRestitutions, const float* MaxRestitutions, const float* DeltaTimes,
+        int Count);
+
+    /** StepBatch restricted to one lane at a time — reference for the SIMD paths */
+    static inline void StepBatchScalar(
+        float* Angles, float* AngularVelocities,
+        const float* HangLengths, const float* AutoSwingForces, const float* DampingLog2s,
+        const float* MinAngles, const float* MaxAngles,
+        const float* MinRestitutions, const float* MaxRestitutions, const float* DeltaTimes,
+        int Count);
+
+    /** Name of the path StepBatch compiles to */
+    static constexpr const char* GetBatchPathName()
+    {
+#if SWING_KERNEL_AVX2
+        return "AVX2";
+#elif SWING_KERNEL_SSE2
+        return "SSE2";
+#elif SWING_KERNEL_NEON
+        return "NEON";
+#else
+        return "Scalar";
+#endif
+    }
+};
+
+namespace SwingPendulumKernel
+{
+    /** Scalar lanes, same polynomial math as the SIMD lanes */
+    struct FScalarLanes
+    {
+        using FReg  = float;
+        using FMask = bool;
+        static constexpr int Width = 1;
+
+        static FReg Load(const float* Src)          { return *Src; }
+        static void Store(float* Dst, FReg Value)   { *Dst = Value; }
+        static FReg Set(float Value)                { return Value; }
+        static FReg Add(FReg A, FReg B)             { return A + B; }
+        static FReg Sub(FReg A, FReg B)             { return A - B; }
+        static FReg Mul(FReg A, FReg B)             { return A * B; }
+        static FReg Div(FReg A, FReg B)             { return A / B; }
+        static FReg Min(FReg A, FReg B)             { return std::min(A, B); }
+        static FReg Max(FReg A, FReg B)             { return std::max(A, B); }
+        static FReg Abs(FReg A)                     { return std::fabs(A); }
+        static FMask Greater(FReg A, FReg B)        { return A > B; }
+        static FMask Less(FReg A, FReg B)           { return A < B; }
+        static FMask And(FMask A, FMask B)          { return A && B; }
+        static FReg Select(FMask M, FReg A, FReg B) { return M ? A : B; }
+        static FReg Round(FReg A)                   { return std::nearbyint(A); }
+        static FReg Pow2(FReg Rounded)              { return std::ldexp(1.0f, static_cast<int>(Rounded)); }
+    };
+
+#if SWING_KERNEL_AVX2
+    struct FSimdLanes
+    {
+        using FReg  = __m256;
+        using FMask = __m256;
+        static constexpr int Width = 8;
+
+        static FReg Load(const float* Src)          { return _mm256_loadu_ps(Src); }
+        static void Store(float* Dst, FReg Value)   { _mm256_storeu_ps(Dst, Value); }
+        static FReg Set(float Value)                { return _mm256_set1_ps(Value); }
+        static FReg Add(FReg A, FReg B)             { return _mm256_add_ps(A, B); }
+        static FReg Sub(FReg A, FReg B)             { return _mm256_sub_ps(A, B); }
+        static FReg Mul(FReg A, FReg B)             { return _mm256_mul_ps(A, B); }
+        static FReg Div(FReg A, FReg B)             { return _mm256_div_ps(A, B); }
+        static FReg Min(FReg A, FReg B)             { return _mm256_min_ps(A, B); }
+        static FReg Max(FReg A, FReg B)             { return _mm256_max_ps(A, B); }
+        static FReg Abs(FReg A)                     { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), A); }
+        static FMask Greater(FReg A, FReg B)        { return _mm256_cmp_ps(A, B, _CMP_GT_OQ); }
+        static FMask Less(FReg A, FReg B)           { return _mm256_cmp_ps(A, B, _CMP_LT_OQ); }
+        static FMask And(FMask A, FMask B)          { return _mm256_and_ps(A, B); }
+        static FReg Select(FMask M, FReg A, FReg B) { return _mm256_blendv_ps(B, A, M); }
+        static FReg Round(FReg A)                   { return _mm256_round_ps(A, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+        static FReg Pow2(FReg Rounded)
+        {
+            const __m256i Exponent = _mm256_add_epi32(_mm256_cvtps_epi32(Rounded), _mm256_set1_epi32(127));
+            return _mm256_castsi256_ps(_mm256_slli_epi32(Exponent, 23));
+        }
+    };
+#elif SWING_KERNEL_SSE2
+    struct FSimdLanes
+    {
+        using FReg  = __m128;
+        using FMask = __m128;
+        static constexpr int Width = 4;
+
+        static FReg Load(const float* Src)          { return _mm_loadu_ps(Src); }
+        static void Store(float* Dst, FReg Value)   { _mm_storeu_ps(Dst, Value); }
+        static FReg Set(float Value)                { return _mm_set1_ps(Value); }
+        static FReg Add(FReg A, FReg B)             { return _mm_add_ps(A, B); }
+        static FReg Sub(FReg A, FReg B)             { return _mm_sub_ps(A, B); }
+        static FReg Mul(FReg A, FReg B)             { return _mm_mul_ps(A, B); }
+        static FReg Div(FReg A, FReg B)             { return _mm_div_ps(A, B); }
+        static FReg Min(FReg A, FReg B)             { return _mm_min_ps(A, B); }
+        static FReg Max(FReg A, FReg B)             { return _mm_max_ps(A, B); }
+        static FReg Abs(FReg A)                     { return _mm_andnot_ps(_mm_set1_ps(-0.0f), A); }
+        static FMask Greater(FReg A, FReg B)        { return _mm_cmpgt_ps(A, B); }
+        static FMask Less(FReg A, FReg B)           { return _mm_cmplt_ps(A, B); }
+        static FMask And(FMask A, FMask B)          { return _mm_and_ps(A, B); }
+        static FReg Select(FMask M, FReg A, FReg B) { return _mm_or_ps(_mm_and_ps(M, A), _mm_andnot_ps(M, B)); }
+        static FReg Round(FReg A)                   { return _mm_cvtepi32_ps(_mm_cvtps_epi32(A)); }
+        static FReg Pow2(FReg Rounded)
+        {
+            const __m128i Exponent = _mm_add_epi32(_mm_cvtps_epi32(Rounded), _mm_set1_epi32(127));
+            return _mm_castsi128_ps(_mm_slli_epi32(Exponent, 23));
+        }
+    };
+#elif SWING_KERNEL_NEON
+    struct FSimdLanes
+    {
+        using FReg  = float32x4_t;
+        using FMask = uint32x4_t;
+        static constexpr int Width = 4;
+
+        static FReg Load(const float* Src)          { return vld1q_f32(Src); }
+        static void Store(float* Dst, FReg Value)   { vst1q_f32(Dst, Value); }
+        static FReg Set(float Value)                { return vdupq_n_f32(Value); }
+        static FReg Add(FReg A, FReg B)             { return vaddq_f32(A, B); }
+        static FReg Sub(FReg A, FReg B)             { return vsubq_f32(A, B); }
+        static FReg Mul(FReg A, FReg B)             { return vmulq_f32(A, B); }
+        static FReg Div(FReg A, FReg B)             { return vdivq_f32(A, B); }
+        static FReg Min(FReg A, FReg B)             { return vminq_f32(A, B); }
+        static FReg Max(FReg A, FReg B)             { return vmaxq_f32(A, B); }
+        static FReg Abs(FReg A)                     { return vabsq_f32(A); }
+        static FMask Greater(FReg A, FReg B)        { return vcgtq_f32(A, B); }
+        static FMask Less(FReg A, FReg B)           { return vcltq_f32(A, B); }
+        static FMask And(FMask A, FMask B)          { return vandq_u32(A, B); }
+        static FReg Select(FMask M, FReg A, FReg B) { return vbslq_f32(M, A, B); }
+        static FReg Round(FReg A)                   { return vrndnq_f32(A); }
+        static FReg Pow2(FReg Rounded)
+        {
+            const int32x4_t Exponent = vaddq_s32(vcvtnq_s32_f32(Rounded), vdupq_n_s32(127));
+            return vreinterpretq_f32_s32(vshlq_n_s32(Exponent, 23));
+        }
+    };
+#else
+    using FSimdLanes = FScalarLanes;
+#endif
+
+    /** sin for |x| ≤ π: fold into [-π/2, π/2], then odd Taylor series to x¹¹ (error < 1e-7) */
+    template <typename L>
+    typename L::FReg Sin(typename L::FReg X)
+    {
+        const typename L::FReg HalfPi = L::Set(1.57079632679f);
+        const typename L::FReg Pi     = L::Set(3.14159265359f);
+
+        X = L::Select(L::Greater(X, HalfPi), L::Sub(Pi, X), X);
+        X = L::Select(L::Less(X, L::Set(-1.57079632679f)), L::Sub(L::Set(-3.14159265359f), X), X);
+
+        const typename L::FReg X2 = L::Mul(X, X);
+        typename L::FReg Poly = L::Set(-2.50521084e-8f);
+        Poly = L::Add(L::Mul(Poly, X2), L::Set(2.75573192e-6f));
+        Poly = L::Add(L::Mul(Poly, X2), L::Set(-1.98412698e-4f));
+        Poly = L::Add(L::Mul(Poly, X2), L::Set(8.33333333e-3f));
+        Poly = L::Add(L::Mul(Poly, X2), L::Set(-1.66666667e-1f));
+        Poly = L::Add(L::Mul(Poly, X2), L::Set(1.0f));
+        return L::Mul(Poly, X);
+    }
+
+    /** 2^x: integer part through the exponent bits, fraction in [-½, ½] by Taylor series (error < 2e-7) */
+    template <typename L>
+    typename L::FReg Exp2(typename L::FReg X)
+    {
+        X = L::Min(L::Max(X, L::Set(-126.0f)), L::Set(126.0f));
+
+        const typename L::FReg Whole = L::Round(X);
+        const typename L::FReg F     = L::Mul(L::Sub(X, Whole), L::Set(0.69314718056f));  // e^(f·ln2)
+
+        typename L::FReg Poly = L::Set(1.38888889e-3f);
+        Poly = L::Add(L::Mul(Poly, F), L::Set(8.33333333e-3f));
+        Poly = L::Add(L::Mul(Poly, F), L::Set(4.16666667e-2f));
+        Poly = L::Add(L::Mul(Poly, F), L::Set(1.66666667e-1f));
+        Poly = L::Add(L::Mul(Poly, F), L::Set(0.5f));
+        Poly = L::Add(L::Mul(Poly, F), L::Set(1.0f));
+        Poly = L::Add(L::Mul(Poly, F), L::Set(1.0f));
+        return L::Mul(Poly, L::Pow2(Whole));
+    }
+
+    template <typename L>
+    typename L::FReg Sign(typename L::FReg X)
+    {
+        const typename L::FReg Zero = L::Set(0.0f);
+        return L::Select(L::Greater(X, Zero), L::Set(1.0f),
+               L::Select(L::Less(X, Zero), L::Set(-1.0f), Zero));
+    }
+
+    /** Steps whole lanes from Begin and returns the first index left over */
+    template <typename L>
+    int StepLanes(
+        float* Angles, float* AngularVelocities,
+        const float* HangLengths, const float* AutoSwingForces, const float* DampingLog2s,
+        const float* MinAngles, const float* MaxAngles,
+        const float* MinRestitutions, const float* MaxRestitutions, const float* DeltaTimes,
+        int Begin, int Count)
+    {
+        using FReg = typename L::FReg;
+
+        const FReg FrameScale = L::Set(60.0f);
+        const FReg NegG       = L::Set(-FSwingPendulumKernel::Gravity);
+        const FReg Threshold  = L::Set(FSwingPendulumKernel::PumpThreshold);
+        const FReg Zero       = L::Set(0.0f);
+
+        int Index = Begin;
+        for (; Index + L::Width <= Count; Index += L::Width)
+        {
+            const FReg Dt        = L::Load(DeltaTimes + Index);
+            const FReg DampScale = L::Mul(Dt, FrameScale);
+
+            FReg Angle           = L::Load(Angles + Index);
+            FReg AngularVelocity = L::Load(AngularVelocities + Index);
+
+            const FReg Alpha = L::Mul(L::Div(NegG, L::Load(HangLengths + Index)), Sin<L>(Angle));
+            AngularVelocity  = L::Add(AngularVelocity, L::Mul(Alpha, Dt));
+
+            const FReg Dir = L::Select(
+                L::Greater(L::Abs(AngularVelocity), Threshold), Sign<L>(AngularVelocity), Sign<L>(Angle));
+            AngularVelocity = L::Add(AngularVelocity, L::Mul(L::Mul(Dir, L::Load(AutoSwingForces + Index)), Dt));
+
+            AngularVelocity = L::Mul(AngularVelocity, Exp2<L>(L::Mul(L::Load(DampingLog2s + Index), DampScale)));
+
+            const FReg MinAngle       = L::Load(MinAngles + Index);
+            const FReg MaxAngle       = L::Load(MaxAngles + Index);
+            const FReg MinRestitution = L::Load(MinRestitutions + Index);
+            const FReg MaxRestitution = L::Load(MaxRestitutions + Index);
+            const FReg Speed          = L::Abs(AngularVelocity);
+
+            // Only limits with a restitution bounce, the plain arc limit just clamps
+            Angle = L::Add(Angle, L::Mul(AngularVelocity, Dt));
+            AngularVelocity = L::Select(L::And(L::Greater(Angle, MaxAngle), L::Greater(MaxRestitution, Zero)),
+                L::Sub(Zero, L::Mul(Speed, MaxRestitution)), AngularVelocity);
+            AngularVelocity = L::Select(L::And(L::Less(Angle, MinAngle), L::Greater(MinRestitution, Zero)),
+                L::Mul(Speed, MinRestitution), AngularVelocity);
+            Angle = L::Min(L::Max(Angle, MinAngle), MaxAngle);
+
+            L::Store(Angles + Index, Angle);
+            L::Store(AngularVelocities + Index, AngularVelocity);
+        }
+        return Index;
+    }
+}
+
+inline void FSwingPendulumKernel::StepBatch(
+    float* Angles, float* AngularVelocities,
+    const float* HangLengths, const float* AutoSwingForces, const float* DampingLog2s,
+    const float* MinAngles, const float* MaxAngles,
+    const float* MinRestitutions, const float* MaxRestitutions, const float* DeltaTimes,
+    int Count)
+{
+    using namespace SwingPendulumKernel;
+
+    const int Tail = StepLanes<FSimdLanes>(
+        Angles, AngularVelocities, HangLengths, AutoSwingForces, DampingLog2s, MinAngles, MaxAngles,
+        MinRestitutions, MaxRestitutions, DeltaTimes,
+        0, Count);
+
+    // Same math lane by lane for the remainder
+    StepLanes<FScalarLanes>(
+        Angles, AngularVelocities, HangLengths, AutoSwingForces, DampingLog2s, MinAngles, MaxAngles,
+        MinRestitutions, MaxRestitutions, DeltaTimes,
+        Tail, Count);
+}
+
+inline void FSwingPendulumKernel::StepBatchScalar(
+    float* Angles, float* AngularVelocities,
+    const float* HangLengths, const float* AutoSwingForces, const float* DampingLog2s,
+    const float* MinAngles, const float* MaxAngles,
+    const float* MinRestitutions, const float* MaxRestitutions, const float* DeltaTimes,
+    int Count)
+{
+    SwingPendulumKernel::StepLanes<SwingPendulumKernel::FScalarLanes>(
+        Angles, AngularVelocities, HangLengths, AutoSwingForces, DampingLog2s, MinAngles, MaxAngles,
+        MinRestitutions, MaxRestitutions, DeltaTimes,
+        0, Count);
+}
@@ -0,0 +1,236 @@
+#include "SwingPhysicsSubsystem.h"
+#include "SwingGame.h"
+#include "SwingComponent.h"
+#include "SwingPendulumKernel.h"
+#include "SwingSimulationSubsystem.h"
+#include "Chaos/SimCallbackInput.h"
+#include "Chaos/SimCallbackObject.h"
+#include "Engine/World.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
+#include "PhysicsEngine/PhysicsSettings.h"
+#include "PBDRigidsSolver.h"
+
+// ---------------------------------------------------------------------------
+// Physics-thread callback
+// ---------------------------------------------------------------------------
+
+struct FSwingPhysicsInput : public Chaos::FSimCallbackInput
+{
+    TArray<FSwingPhysicsSwinger> Swingers;
+
+    void Reset() { Swingers.Reset(); }
+};
+
+struct FSwingPhysicsOutput : public Chaos::FSimCallbackOutput
+{
+    TArray<FSwingPhysicsState> States;
+    float DeltaTime = 0.0f;
+
+    void Reset() { States.Reset(); DeltaTime = 0.0f; }
+};
+
+class FSwingPhysicsCallback : public Chaos::TSimCallbackObject<FSwingPhysicsInput, FSwingPhysicsOutput>
+{
+    virtual void OnPreSimulate_Internal() override
+    {
+        // A step without fresh input keeps the last known set of swingers
+        if (const FSwingPhysicsInput* Input = GetConsumerInput_Internal())
+        {
+            Simulated.RemoveAllSwap([Input](const FSwingPhysicsSwinger& Swinger)
+            {
+                return !Input->Swingers.ContainsByPredicate([&Swinger](const FSwingPhysicsSwinger& Active)
+                {
+                    return Active.Id == Swinger.Id;
+                });
+            }, EAllowShrinking::No);
+
+            for (const FSwingPhysicsSwinger& Active : Input->Swingers)
+            {
+                if (!Simulated.ContainsByPredicate([&Active](const FSwingPhysicsSwinger& Swinger) { return Swinger.Id == Active.Id; }))
+                    Simulated.Add(Active);
+            }
+        }
+
+        if (Simulated.IsEmpty()) return;
+
+        const float DeltaTime = static_cast<float>(GetDeltaTime_Internal());
+
+        FSwingPhysicsOutput& Output = GetProducerOutputData_Internal();
+        Output.States.Reset(Simulated.Num());
+        Output.DeltaTime = DeltaTime;
+
+        for (FSwingPhysicsSwinger& Swinger : Simulated)
+        {
+            FSwingPhysicsState& State = Output.States.AddDefaulted_GetRef();
+            State.Id        = Swinger.Id;
+            State.PrevAngle = Swinger.Angle;
+
+            FSwingPendulumKernel::Step(
+                Swinger.Angle, Swinger.AngularVelocity,
+                Swinger.HangLength, Swinger.AutoSwingForce, Swinger.Damping,
+                Swinger.MinAngle, Swinger.MaxAngle, DeltaTime, Swinger.MinRestitution, Swinger.MaxRestitution);
+
+            State.Angle           = Swinger.Angle;
+            State.AngularVelocity = Swinger.AngularVelocity;
+        }
+    }
+
+    /** Physics-thread copy of every swinger being stepped */
+    TArray<FSwingPhysicsSwinger> Simulated;
+};
+
+// ---------------------------------------------------------------------------
+// Subsystem
+// ---------------------------------------------------------------------------
+
+bool USwingPhysicsSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId USwingPhysicsSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USwingPhysicsSubsystem, STATGROUP_Tickables);
+}
+
+void USwingPhysicsSubsystem::Deinitialize()
+{
+    if (Callback)
+    {
+        if (FPhysScene* Scene = GetWorld()->GetPhysicsScene())
+            Scene->GetSolver()->UnregisterAndFreeSimCallbackObject_External(Callback);
+        Callback = nullptr;
+    }
+
+    Super::Deinitialize();
+}
+
+bool USwingPhysicsSubsystem::EnsureCallback()
+{
+    if (Callback) return true;
+
+    FPhysScene* Scene = GetWorld()->GetPhysicsScene();
+    if (!Scene || !Scene->GetSolver()) return false;
+
+    Callback = Scene->GetSolver()->CreateAndRegisterSimCallbackObject_External<FSwingPhysicsCallback>();
+    return Callback != nullptr;
+}
+
+bool USwingPhysicsSubsystem::AddSwinger(USwingComponent* Swinger)
+{
+    if (!IsValid(Swinger) || Swinger->PhysicsSwingId != INDEX_NONE) return false;
+
+    // Without async physics the callback runs inside the game-thread physics tick at a
+    // variable step — no better than Batched, so leave the swing to it
+    if (!UPhysicsSettings::Get()->bTickPhysicsAsync)
+    {
+        if (!bWarnedSyncPhysics)
+        {
+            UE_LOG(LogSwingGame, Warning,
+                TEXT("Async Physics swing mode needs Tick Physics Async in the physics settings — swinging Batched instead"));
+            bWarnedSyncPhysics = true;
+        }
+        return false;
+    }
+
+    if (!EnsureCallback()) return false;
+
+    FSwingPhysicsSwinger& Seed = Seeds.AddDefaulted_GetRef();
+    Seed.Id              = NextId++;
+    Seed.Angle           = Swinger->SwingAngle;
+    Seed.AngularVelocity = Swinger->SwingAngularVelocity;
+    Seed.HangLength      = Swinger->HangLength;
+    Seed.AutoSwingForce  = Swinger->AutoSwingForce;
+    Seed.Damping         = Swinger->SwingDamping;
+    Seed.MinAngle        = Swinger->SwingMinAngle;
+    Seed.MaxAngle        = Swinger->SwingMaxAngle;
+    Seed.MinRestitution  = Swinger->SwingMinRestitution;
+    Seed.MaxRestitution  = Swinger->SwingMaxRestitution;
+
+    Swingers.Add(Swinger);
+    Swinger->PhysicsSwingId = Seed.Id;
+    return true;
+}
+
+void USwingPhysicsSubsystem::RemoveSwinger(USwingComponent* Swinger)
+{
+    const int32 Index = Swingers.IndexOfByKey(Swinger);
+    if (Index == INDEX_NONE) return;
+
+    Swingers.RemoveAtSwap(Index, EAllowShrinking::No);
+    Seeds.RemoveAtSwap(Index, EAllowShrinking::No);
+}
+
+void USwingPhysicsSubsystem::Tick(float DeltaTime)
+{
+    if (!Callback) return;
+
+    // The physics thread reconciles against the full set, so a dropped input is harmless
+    if (FSwingPhysicsInput* Input = Callback->GetProducerInputData_External())
+        Input->Swingers = Seeds;
+
+    // Future outputs too — the one after the results time is the interpolation target
+    while (Chaos::TSimCallbackOutputHandle<FSwingPhysicsOutput> Output = Callback->PopFutureOutputData_External())
+    {
+        FSwingPhysicsFrame& Frame = Frames.AddDefaulted_GetRef();
+        Frame.Time      = Output->InternalTime;
+        Frame.DeltaTime = Output->DeltaTime;
+
+        Frame.States.Reserve(Output->States.Num());
+        for (const FSwingPhysicsState& State : Output->States)
+            Frame.States.Add(State.Id, State);
+    }
+
+    const double ResultsTime = GetWorld()->GetPhysicsScene()->GetSolver()->GetPhysicsResultsTime_External();
+
+    // Each step counts once, when rendering first passes it
+    SimulatedTimes.Reset();
+    for (FSwingPhysicsFrame& Frame : Frames)
+    {
+        if (Frame.Time > ResultsTime) break;
+        if (Frame.bReached) continue;
+
+        for (const TPair<int32, FSwingPhysicsState>& Pair : Frame.States)
+            SimulatedTimes.FindOrAdd(Pair.Key) += Frame.DeltaTime;
+        Frame.bReached = true;
+    }
+
+    // Keep the newest reached frame and everything after it
+    int32 NumPassed = 0;
+    while (NumPassed + 1 < Frames.Num() && Frames[NumPassed + 1].Time <= ResultsTime)
+        ++NumPassed;
+    Frames.RemoveAt(0, NumPassed, EAllowShrinking::No);
+
+    if (Frames.IsEmpty() || !Frames[0].bReached) return;
+
+    const FSwingPhysicsFrame& From = Frames[0];
+    const FSwingPhysicsFrame* To   = Frames.Num() > 1 ? &Frames[1] : nullptr;
+    const float Alpha = To
+        ? static_cast<float>(FMath::Clamp((ResultsTime - From.Time) / (To->Time - From.Time), 0.0, 1.0))
+        : 0.0f;
+
+    // Walk backwards — a swinger released during its commit removes itself
+    for (int32 i = Swingers.Num() - 1; i >= 0; --i)
+    {
+        if (!Swingers.IsValidIndex(i)) continue;
+
+        const FSwingPhysicsState* State = From.States.Find(Seeds[i].Id);
+        if (!State) continue;
+
+        // Hold the step reached when the next one has dropped this swinger
+        const FSwingPhysicsState* Next = To ? To->States.Find(Seeds[i].Id) : nullptr;
+        if (!Next) Next = State;
+
+        USwingComponent* Swinger = Swingers[i];
+        const float      L       = Seeds[i].HangLength;
+        const float      Angle   = FMath::Lerp(State->Angle, Next->Angle, Alpha);
+        const float      Omega   = FMath::Lerp(State->AngularVelocity, Next->AngularVelocity, Alpha);
+
+        const FVector NewPos = Swinger->PivotWorldLocation
+            + FVector(FMath::Sin(Angle), 0.0f, -FMath::Cos(Angle)) * L;
+        const FVector Velocity = USwingSimulationSubsystem::GetTangentVelocity(Angle, Omega, L);
+
+        Swinger->CommitSimulatedSwing(
+            Angle, Omega, State->Angle, 0.0f, NewPos, Velocity, SimulatedTimes.FindRef(Seeds[i].Id));
+    }
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SwingPhysicsSubsystem.generated.h"
+
+class USwingComponent;
+class FSwingPhysicsCallback;
+
+/** Pendulum a swinger starts with on the physics thread, plus its tuning */
+struct FSwingPhysicsSwinger
+{
+    int32 Id              = INDEX_NONE;
+    float Angle           = 0.0f;
+    float AngularVelocity = 0.0f;
+    float HangLength      = 0.0f;
+    float AutoSwingForce  = 0.0f;
+    float Damping         = 0.0f;
+    float MinAngle        = 0.0f;
+    float MaxAngle        = 0.0f;
+    float MinRestitution  = 0.0f;
+    float MaxRestitution  = 0.0f;
+};
+
+/** Pendulum after a physics step */
+struct FSwingPhysicsState
+{
+    int32 Id              = INDEX_NONE;
+    float Angle           = 0.0f;
+    float PrevAngle       = 0.0f;
+    float AngularVelocity = 0.0f;
+};
+
+/** Every swinger's state after one physics step, buffered until rendering passes it */
+struct FSwingPhysicsFrame
+{
+    double Time      = 0.0;
+    float  DeltaTime = 0.0f;
+    bool   bReached  = false;   // render time has passed it, its step is accounted for
+
+    TMap<int32, FSwingPhysicsState> States;
+};
+
+/**
+ * Steps swing pendulums inside the Chaos solver (ESwingSimulationMode::AsyncPhysics).
+ *
+ * A sim callback object integrates every registered swinger in OnPreSimulate_Internal
+ * at the fixed async physics step, on the physics thread. Swingers are only accepted
+ * while async physics is enabled (Project Settings > Physics > Tick Physics Async);
+ * otherwise the component falls back to Batched. Each game-thread tick pushes the set of
+ * active swingers (new ones are seeded from it, missing ones dropped), buffers the stepped
+ * outputs, and applies the pendulum interpolated at the solver's results time — the same
+ * time Chaos renders rigid bodies at — so swings stay smooth when frames outpace steps.
+ */
+UCLASS()
+class SWINGGAME_API USwingPhysicsSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** Hands Swinger's pendulum to the physics thread — false without async physics or a physics scene */
+    bool AddSwinger(USwingComponent* Swinger);
+
+    /** Stops stepping Swinger — its component keeps the last applied state */
+    void RemoveSwinger(USwingComponent* Swinger);
+
+    int32 GetNumSwingers() const { return Swingers.Num(); }
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    bool EnsureCallback();
+
+    FSwingPhysicsCallback* Callback = nullptr;
+
+    UPROPERTY()
+    TArray<TObjectPtr<USwingComponent>> Swingers;
+
+    /** Parallel to Swingers — pushed to the physics thread every tick */
+    TArray<FSwingPhysicsSwinger> Seeds;
+
+    /** Outputs from the newest one at or before the results time onwards, oldest first */
+    TArray<FSwingPhysicsFrame> Frames;
+
+    /** Physics time each swing id advanced by this tick */
+    TMap<int32, float> SimulatedTimes;
+
+    bool bWarnedSyncPhysics = false;
+
+    int32 NextId = 0;
+};
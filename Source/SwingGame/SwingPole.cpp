@@ -1,6 +1,8 @@
 #include "SwingPole.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/SphereComponent.h"
+#include "SwingPoleSubsystem.h"
+#include "Engine/World.h"
 
 ASwingPole::ASwingPole()
 {
@@ -9,26 +11,42 @@ ASwingPole::ASwingPole()
     GrabTrigger = CreateDefaultSubobject<USphereComponent>(TEXT("GrabTrigger"));
     SetRootComponent(GrabTrigger);
     GrabTrigger->SetSphereRadius(200.0f);
-    GrabTrigger->SetCollisionProfileName(TEXT("OverlapAllDynamic"));
-    GrabTrigger->SetGenerateOverlapEvents(true);
+    GrabTrigger->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    GrabTrigger->SetGenerateOverlapEvents(false);
 
     PoleMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("PoleMesh"));
     PoleMesh->SetupAttachment(GrabTrigger);
     PoleMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 }
 
+void ASwingPole::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (USwingPoleSubsystem* Poles = GetWorld()->GetSubsystem<USwingPoleSubsystem>())
+        Poles->RegisterPole(this);
+}
+
+void ASwingPole::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (USwingPoleSubsystem* Poles = GetWorld()->GetSubsystem<USwingPoleSubsystem>())
+        Poles->UnregisterPole(this);
+
+    Super::EndPlay(EndPlayReason);
+}
+
 FVector ASwingPole::GetGrabPoint(const FVector& CharacterLocation) const
 {
-    const FVector PoleDir   = GetActorRightVector();
-    const FVector PoleStart = GetActorLocation() - PoleDir * PoleHalfLength;
-
-    const float T = FMath::Clamp(
-        FVector::DotProduct(CharacterLocation - PoleStart, PoleDir),
-        0.0f,
-        PoleHalfLength * 2.0f
-    );
-
-    const FVector Closest = PoleStart + PoleDir * T;
-    // Keep pole's Z — hands always at pole height
-    return FVector(Closest.X, Closest.Y, GetActorLocation().Z);
+    return GetSegment().GetGrabPoint(CharacterLocation);
+}
+
+FSwingPoleSegment ASwingPole::GetSegment() const
+{
+    FSwingPoleSegment Segment;
+    Segment.Center     = GetActorLocation();
+    Segment.Direction  = GetActorRightVector();
+    Segment.HalfLength = PoleHalfLength;
+    Segment.Reach      = GrabTrigger ? GrabTrigger->GetScaledSphereRadius() : 0.0f;
+    Segment.Owner      = const_cast<ASwingPole*>(this);
+    return Segment;
 }
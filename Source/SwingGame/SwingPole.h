@@ -4,6 +4,8 @@
 #include "GameFramework/Actor.h"
 #include "SwingPole.generated.h"
 
+struct FSwingPoleSegment;
+
 /**
  * A horizontal pole the character can grab and swing on.
  * Create a Blueprint child (BP_SwingPole), assign a cylinder mesh,
@@ -17,6 +19,9 @@ class SWINGGAME_API ASwingPole : public AActor
 public:
     ASwingPole();
 
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     /**
      * Returns the closest point on the pole axis to CharacterLocation.
      * Z is locked to the pole's own height so hands always hang at the right level.
@@ -24,11 +29,15 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Swing")
     FVector GetGrabPoint(const FVector& CharacterLocation) const;
 
+    /** World-space grab segment, as registered with USwingPoleSubsystem */
+    FSwingPoleSegment GetSegment() const;
+
     /** Visual mesh — assign a horizontal cylinder in the Blueprint */
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
     class UStaticMeshComponent* PoleMesh;
 
-    /** Trigger sphere used by SwingComponent to detect this pole */
+    /** Grab reach around the pole — its radius is registered with USwingPoleSubsystem.
+     *  Carries no collision; detection goes through the subsystem's grid. */
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
     class USphereComponent* GrabTrigger;
 
@@ -0,0 +1,78 @@
+#include "SwingPoleField.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "SwingPoleSubsystem.h"
+#include "Engine/World.h"
+
+ASwingPoleField::ASwingPoleField()
+{
+    PrimaryActorTick.bCanEverTick = false;
+
+    SetRootComponent(CreateDefaultSubobject<USceneComponent>(TEXT("Root")));
+
+    PoleInstances = CreateDefaultSubobject<UInstancedStaticMeshComponent>(TEXT("PoleInstances"));
+    PoleInstances->SetupAttachment(GetRootComponent());
+    PoleInstances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    PoleInstances->SetGenerateOverlapEvents(false);
+}
+
+void ASwingPoleField::OnConstruction(const FTransform& Transform)
+{
+    Super::OnConstruction(Transform);
+
+    RebuildInstances();
+}
+
+void ASwingPoleField::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (USwingPoleSubsystem* Registry = GetWorld()->GetSubsystem<USwingPoleSubsystem>())
+        Registry->RegisterField(this);
+}
+
+void ASwingPoleField::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (USwingPoleSubsystem* Registry = GetWorld()->GetSubsystem<USwingPoleSubsystem>())
+        Registry->UnregisterField(this);
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void ASwingPoleField::RebuildInstances()
+{
+    TArray<FTransform> Transforms;
+    Transforms.Reserve(Poles.Num());
+    for (const FSwingPoleFieldEntry& Entry : Poles)
+        Transforms.Add(Entry.Transform);
+
+    PoleInstances->ClearInstances();
+    PoleInstances->AddInstances(Transforms, false);
+
+    // Keep the registry in sync when poles change during play
+    if (HasActorBegunPlay())
+    {
+        if (USwingPoleSubsystem* Registry = GetWorld()->GetSubsystem<USwingPoleSubsystem>())
+            Registry->RegisterField(this);
+    }
+}
+
+FSwingPoleSegment ASwingPoleField::GetSegment(int32 Index) const
+{
+    const FTransform World = Poles[Index].Transform * GetActorTransform();
+
+    FSwingPoleSegment Segment;
+    Segment.Center        = World.GetLocation();
+    Segment.Direction     = World.GetUnitAxis(EAxis::Y);
+    Segment.HalfLength    = Poles[Index].HalfLength;
+    Segment.Reach         = GrabReach;
+    Segment.Owner         = const_cast<ASwingPoleField*>(this);
+    Segment.InstanceIndex = Index;
+    return Segment;
+}
+
+FVector ASwingPoleField::GetGrabPoint(int32 Index, const FVector& CharacterLocation) const
+{
+    if (!Poles.IsValidIndex(Index)) return CharacterLocation;
+
+    return GetSegment(Index).GetGrabPoint(CharacterLocation);
+}
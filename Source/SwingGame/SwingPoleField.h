@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "SwingPoleField.generated.h"
+
+struct FSwingPoleSegment;
+
+/** One pole of an ASwingPoleField */
+USTRUCT(BlueprintType)
+struct SWINGGAME_API FSwingPoleFieldEntry
+{
+    GENERATED_BODY()
+
+    /** Pole transform relative to the field — also used as-is for the mesh instance */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pole", meta = (MakeEditWidget))
+    FTransform Transform;
+
+    /** Half-length of the pole along its local right vector (cm) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pole")
+    float HalfLength = 150.0f;
+};
+
+/**
+ * Many swing poles in one actor.
+ * Poles are plain entries in an array, drawn by a single instanced static mesh
+ * and registered with USwingPoleSubsystem as one batch. Grabbing behaves exactly
+ * like ASwingPole — use this for large traversal courses where one actor per pole
+ * is too heavy.
+ */
+UCLASS()
+class SWINGGAME_API ASwingPoleField : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    ASwingPoleField();
+
+    virtual void OnConstruction(const FTransform& Transform) override;
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    /** Same as ASwingPole::GetGrabPoint for the pole at Index */
+    UFUNCTION(BlueprintCallable, Category = "Swing")
+    FVector GetGrabPoint(int32 Index, const FVector& CharacterLocation) const;
+
+    /** World-space grab segment of the pole at Index */
+    FSwingPoleSegment GetSegment(int32 Index) const;
+
+    int32 GetNumPoles() const { return Poles.Num(); }
+
+    /** Rebuilds the mesh instances from Poles — call after editing Poles at runtime */
+    UFUNCTION(BlueprintCallable, Category = "Swing")
+    void RebuildInstances();
+
+    /** Visual mesh — assign a horizontal cylinder, one instance is drawn per pole */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+    class UInstancedStaticMeshComponent* PoleInstances;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pole")
+    TArray<FSwingPoleFieldEntry> Poles;
+
+    /** Grab reach around each pole centre — same role as ASwingPole's GrabTrigger radius */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pole")
+    float GrabReach = 200.0f;
+};
@@ -0,0 +1,399 @@
+#include "SwingPoleGraph.h"
+#include "SwingComponent.h"
+#include "SwingGame.h"
+#include "SwingPole.h"
+#include "SwingPoleField.h"
+#include "SwingPoleSubsystem.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "HAL/PlatformTime.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Reverse.h"
+
+float FSwingReachTuning::GetSteadyAmplitude(float InHangLength) const
+{
+    // Same cycle-averaged balance as FSwingPendulumEnvelope: V = (2F/π) / (k/2), k = -60·ln(Damping)
+    const float GravityOverLength = Gravity / FMath::Max(InHangLength, 1.0f);
+    const float Decay = -30.0f * FMath::Loge(FMath::Clamp(SwingDamping, KINDA_SMALL_NUMBER, 1.0f));
+    if (Decay <= KINDA_SMALL_NUMBER) return MaxSwingAngle;
+
+    const float PeakSpeed    = (2.0f * AutoSwingForce / UE_PI) / Decay;
+    const float CosAmplitude = 1.0f - (PeakSpeed * PeakSpeed) / (2.0f * GravityOverLength);
+    const float Amplitude    = CosAmplitude <= -1.0f ? UE_PI : FMath::Acos(CosAmplitude);
+    return FMath::Min(Amplitude, MaxSwingAngle);
+}
+
+bool FSwingReachTuning::CopyFromSwinger(TSubclassOf<ACharacter> SwingerClass)
+{
+    const ACharacter* Swinger = SwingerClass ? SwingerClass->GetDefaultObject<ACharacter>() : nullptr;
+    const USwingComponent* Swing = Swinger ? Swinger->FindComponentByClass<USwingComponent>() : nullptr;
+    if (!Swing) return false;
+
+    AutoSwingForce        = Swing->AutoSwingForce;
+    SwingDamping          = Swing->SwingDamping;
+    LaunchSpeedMultiplier = Swing->LaunchSpeedMultiplier;
+    MaxSwingAngle         = Swing->MaxSwingAngle;
+    GrabDetectionRadius   = Swing->GrabDetectionRadius;
+    return true;
+}
+
+ASwingPoleGraph::ASwingPoleGraph()
+{
+    PrimaryActorTick.bCanEverTick = false;
+
+    SetRootComponent(CreateDefaultSubobject<USceneComponent>(TEXT("Root")));
+}
+
+void ASwingPoleGraph::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (USwingPoleSubsystem* Registry = GetWorld()->GetSubsystem<USwingPoleSubsystem>())
+        Registry->RegisterGraph(this);
+}
+
+void ASwingPoleGraph::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (USwingPoleSubsystem* Registry = GetWorld()->GetSubsystem<USwingPoleSubsystem>())
+        Registry->UnregisterGraph(this);
+
+    Super::EndPlay(EndPlayReason);
+}
+
+// ---------------------------------------------------------------------------
+// Bake
+// ---------------------------------------------------------------------------
+
+void ASwingPoleGraph::Bake()
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+#if WITH_EDITOR
+    Modify();
+#endif
+
+    Tuning.CopyFromSwinger(SwingerClass);
+
+    GatherNodes();
+
+    // A pole is held as far below it as the character was at the grab, anywhere
+    // from the shortest hang down to the grab reach — bake that whole range
+    float MaxReach = 0.0f;
+    for (const FSwingPoleGraphNode& Node : Nodes)
+        MaxReach = FMath::Max(MaxReach, Node.Reach);
+
+    const float MinHang = USwingComponent::MinHangLength;
+    const float MaxHang = FMath::Max(Tuning.GrabDetectionRadius + MaxReach, MinHang);
+
+    HangLengths.Reset(HangLengthSamples);
+    for (int32 Sample = 0; Sample < HangLengthSamples; ++Sample)
+    {
+        HangLengths.Add(HangLengthSamples > 1
+            ? FMath::Lerp(MinHang, MaxHang, float(Sample) / float(HangLengthSamples - 1))
+            : Tuning.HangLength);
+    }
+
+    EdgeOffsets.Reset(Nodes.Num() + 1);
+    Edges.Reset();
+
+    for (int32 Source = 0; Source < Nodes.Num(); ++Source)
+    {
+        EdgeOffsets.Add(Edges.Num());
+        for (const float HangLength : HangLengths)
+        {
+            for (int32 Target = 0; Target < Nodes.Num(); ++Target)
+            {
+                if (Target != Source)
+                    BakeEdges(Nodes[Source], Nodes[Target], Target, Tuning, HangLength, ReleaseSamples, Edges);
+            }
+        }
+    }
+    EdgeOffsets.Add(Edges.Num());
+
+    UE_LOG(LogSwingGame, Log, TEXT("Baked swing pole graph %s: %d poles, %d edges in %.1f ms"),
+        *GetName(), Nodes.Num(), Edges.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void ASwingPoleGraph::GatherNodes()
+{
+    Nodes.Reset();
+
+    ULevel* Level = GetLevel();
+    if (!Level) return;
+
+    auto AddNode = [this](const FSwingPoleSegment& Segment)
+    {
+        FSwingPoleGraphNode& Node = Nodes.AddDefaulted_GetRef();
+        Node.Center        = Segment.Center;
+        Node.Direction     = Segment.Direction;
+        Node.HalfLength    = Segment.HalfLength;
+        Node.Reach         = Segment.Reach;
+        Node.Owner         = Segment.Owner.Get();
+        Node.InstanceIndex = Segment.InstanceIndex;
+    };
+
+    for (AActor* Actor : Level->Actors)
+    {
+        if (const ASwingPole* Pole = Cast<ASwingPole>(Actor))
+        {
+            AddNode(Pole->GetSegment());
+        }
+        else if (const ASwingPoleField* Field = Cast<ASwingPoleField>(Actor))
+        {
+            for (int32 Index = 0; Index < Field->GetNumPoles(); ++Index)
+                AddNode(Field->GetSegment(Index));
+        }
+    }
+}
+
+void ASwingPoleGraph::BakeEdges(
+    const FSwingPoleGraphNode& Source, const FSwingPoleGraphNode& Target, int32 TargetIndex,
+    const FSwingReachTuning& Tuning, float HangLength, int32 NumSamples, TArray<FSwingPoleGraphEdge>& OutEdges)
+{
+    FSwingPoleSegment SourceSegment;
+    SourceSegment.Center     = Source.Center;
+    SourceSegment.Direction  = Source.Direction;
+    SourceSegment.HalfLength = Source.HalfLength;
+
+    const FVector Pivot = SourceSegment.GetGrabPoint(Target.Center);
+    const float   Range = Tuning.GrabDetectionRadius + Target.Reach;
+    const float   L     = FMath::Max(HangLength, 1.0f);
+    const float   G     = Tuning.Gravity;
+
+    // Swings and releases stay in world XZ, so Y never changes during flight
+    const float OffsetY   = Target.Center.Y - Pivot.Y;
+    const float RangeXZSq = FMath::Square(Range) - FMath::Square(OffsetY);
+    if (RangeXZSq <= 0.0f || G <= KINDA_SMALL_NUMBER) return;
+
+    const float Amplitude         = Tuning.GetSteadyAmplitude(L);
+    const float CosAmplitude      = FMath::Cos(Amplitude);
+    const float GravityOverLength = G / L;
+    const float MaxSpeed          = L * FMath::Sqrt(2.0f * GravityOverLength * (1.0f - CosAmplitude)) * Tuning.LaunchSpeedMultiplier;
+
+    // Grabbing needs the pole above — flight is over once below Target.Center.Z - Range.
+    // Bound the whole flight by the fastest, highest launch and skip pairs it cannot span.
+    const float FloorZ = Target.Center.Z - FMath::Sqrt(RangeXZSq);
+    const float Disc   = MaxSpeed * MaxSpeed + 2.0f * G * (Pivot.Z + L - FloorZ);
+    if (Disc < 0.0f) return;
+    const float MaxTime = (MaxSpeed + FMath::Sqrt(Disc)) / G;
+    if (FMath::Abs(Target.Center.X - Pivot.X) > MaxSpeed * MaxTime + L + Range) return;
+
+    // First grabbable moment of a flight, same rule as USwingPoleSubsystem::FindNearestSegment
+    auto FindGrabTime = [&](const FVector& Launch, const FVector& Velocity, float& OutTime)
+    {
+        constexpr float TimeStep      = 1.0f / 60.0f;
+        constexpr int32 NumBisections = 6;
+
+        auto IsGrabbable = [&](float Time)
+        {
+            const float X = Launch.X + Velocity.X * Time - Target.Center.X;
+            const float Z = Launch.Z + Velocity.Z * Time - 0.5f * G * Time * Time - Target.Center.Z;
+            return Z < 0.0f && X * X + Z * Z <= RangeXZSq;
+        };
+
+        for (float Time = 0.0f; Time <= MaxTime; Time += TimeStep)
+        {
+            if (!IsGrabbable(Time)) continue;
+
+            float Lo = FMath::Max(Time - TimeStep, 0.0f);
+            float Hi = Time;
+            for (int32 Step = 0; Time > 0.0f && Step < NumBisections; ++Step)
+            {
+                const float Mid = 0.5f * (Lo + Hi);
+                (IsGrabbable(Mid) ? Hi : Lo) = Mid;
+            }
+            OutTime = Hi;
+            return true;
+        }
+        return false;
+    };
+
+    NumSamples = FMath::Max(NumSamples, 2);
+
+    TArray<float, TInlineAllocator<128>> RunTimes;
+    TArray<float, TInlineAllocator<128>> RunHangs;
+    for (const int8 Direction : { int8(1), int8(-1) })
+    {
+        float RunStart = 0.0f;
+        float RunEnd   = 0.0f;
+        RunTimes.Reset();
+        RunHangs.Reset();
+
+        auto CloseRun = [&]()
+        {
+            if (RunTimes.IsEmpty()) return;
+
+            FSwingPoleGraphEdge& Edge = OutEdges.AddDefaulted_GetRef();
+            Edge.Target            = TargetIndex;
+            Edge.MinReleaseAngle   = RunStart;
+            Edge.MaxReleaseAngle   = RunEnd;
+            Edge.Direction         = Direction;
+            Edge.FlightTime        = RunTimes[RunTimes.Num() / 2];
+            Edge.HangLength        = L;
+            Edge.ArrivalHangLength = RunHangs[RunHangs.Num() / 2];
+            RunTimes.Reset();
+            RunHangs.Reset();
+        };
+
+        for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+        {
+            const float Angle = FMath::Lerp(-Amplitude, Amplitude, float(Sample) / float(NumSamples - 1));
+
+            // Steady swing: ½ω² = (g/L)(cos θ - cos A)
+            const float AngularVelocity = Direction * FMath::Sqrt(
+                FMath::Max(2.0f * GravityOverLength * (FMath::Cos(Angle) - CosAmplitude), 0.0f));
+
+            float Sin, Cos;
+            FMath::SinCos(&Sin, &Cos, Angle);
+            const FVector Launch   = Pivot + FVector(Sin, 0.0f, -Cos) * L;
+            const FVector Velocity = FVector(Cos, 0.0f, Sin) * (L * AngularVelocity * Tuning.LaunchSpeedMultiplier);
+
+            float FlightTime = 0.0f;
+            if (FindGrabTime(Launch, Velocity, FlightTime))
+            {
+                if (RunTimes.IsEmpty()) RunStart = Angle;
+                RunEnd = Angle;
+                RunTimes.Add(FlightTime);
+
+                // Grabbing hangs from the pole as far below it as the character is (USwingComponent::OnGrabbed)
+                const float GrabZ = Launch.Z + Velocity.Z * FlightTime - 0.5f * G * FlightTime * FlightTime;
+                RunHangs.Add(FMath::Max(Target.Center.Z - GrabZ, USwingComponent::MinHangLength));
+            }
+            else
+            {
+                CloseRun();
+            }
+        }
+        CloseRun();
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Queries
+// ---------------------------------------------------------------------------
+
+TConstArrayView<FSwingPoleGraphEdge> ASwingPoleGraph::GetEdges(int32 Node) const
+{
+    if (!EdgeOffsets.IsValidIndex(Node + 1)) return {};
+
+    return TConstArrayView<FSwingPoleGraphEdge>(
+        Edges.GetData() + EdgeOffsets[Node], EdgeOffsets[Node + 1] - EdgeOffsets[Node]);
+}
+
+int32 ASwingPoleGraph::FindNode(const FVector& Location, float Radius) const
+{
+    int32 Best     = INDEX_NONE;
+    float BestDist = TNumericLimits<float>::Max();
+
+    for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+    {
+        const FSwingPoleGraphNode& Node = Nodes[Index];
+        if (Node.Center.Z <= Location.Z) continue;  // must be above
+
+        const float Dist = FVector::Dist(Location, Node.Center);
+        if (Dist <= Radius + Node.Reach && Dist < BestDist)
+        {
+            BestDist = Dist;
+            Best     = Index;
+        }
+    }
+    return Best;
+}
+
+int32 ASwingPoleGraph::FindNodeForPole(const AActor* Pole, int32 InstanceIndex) const
+{
+    return Nodes.IndexOfByPredicate([Pole, InstanceIndex](const FSwingPoleGraphNode& Node)
+    {
+        return Node.Owner == Pole && Node.InstanceIndex == InstanceIndex;
+    });
+}
+
+int32 ASwingPoleGraph::FindHangSample(float HangLength) const
+{
+    int32 Best = 0;
+    for (int32 Index = 1; Index < HangLengths.Num(); ++Index)
+    {
+        if (FMath::Abs(HangLengths[Index] - HangLength) < FMath::Abs(HangLengths[Best] - HangLength))
+            Best = Index;
+    }
+    return Best;
+}
+
+bool ASwingPoleGraph::FindPath(
+    int32 Start, int32 Goal, TArray<FSwingPoleGraphEdge>& OutEdges, float StartHangLength) const
+{
+    OutEdges.Reset();
+    const int32 NumHangs = HangLengths.Num();
+    if (!Nodes.IsValidIndex(Start) || !Nodes.IsValidIndex(Goal) || EdgeOffsets.Num() != Nodes.Num() + 1 || NumHangs == 0)
+        return false;
+    if (Start == Goal) return true;
+
+    struct FOpenNode
+    {
+        float Cost;
+        int32 State;
+        bool operator<(const FOpenNode& Other) const { return Cost < Other.Cost; }
+    };
+
+    // Dijkstra over flight time on (pole, hang) states: the hang a pole is held at
+    // picks which of its edges work, and each flight sets the hang on the next pole
+    TArray<float> Costs;
+    TArray<int32> ViaEdges;
+    Costs.Init(TNumericLimits<float>::Max(), Nodes.Num() * NumHangs);
+    ViaEdges.Init(INDEX_NONE, Nodes.Num() * NumHangs);
+
+    TArray<FOpenNode> Open;
+    const int32 StartHang = StartHangLength >= 0.0f ? FindHangSample(StartHangLength) : INDEX_NONE;
+    for (int32 Hang = 0; Hang < NumHangs; ++Hang)
+    {
+        if (StartHang != INDEX_NONE && Hang != StartHang) continue;
+
+        Costs[Start * NumHangs + Hang] = 0.0f;
+        Open.HeapPush({ 0.0f, Start * NumHangs + Hang });
+    }
+
+    int32 GoalState = INDEX_NONE;
+    while (!Open.IsEmpty())
+    {
+        FOpenNode Current;
+        Open.HeapPop(Current, EAllowShrinking::No);
+
+        const int32 Node = Current.State / NumHangs;
+        if (Node == Goal)
+        {
+            GoalState = Current.State;
+            break;
+        }
+        if (Current.Cost > Costs[Current.State]) continue;  // stale entry
+
+        const int32 Hang = Current.State % NumHangs;
+        for (int32 EdgeIndex = EdgeOffsets[Node]; EdgeIndex < EdgeOffsets[Node + 1]; ++EdgeIndex)
+        {
+            const FSwingPoleGraphEdge& Edge = Edges[EdgeIndex];
+            if (FindHangSample(Edge.HangLength) != Hang) continue;
+
+            const int32 Next = Edge.Target * NumHangs + FindHangSample(Edge.ArrivalHangLength);
+            const float Cost = Current.Cost + Edge.FlightTime;
+            if (Cost >= Costs[Next]) continue;
+
+            Costs[Next]    = Cost;
+            ViaEdges[Next] = EdgeIndex;
+            Open.HeapPush({ Cost, Next });
+        }
+    }
+
+    if (GoalState == INDEX_NONE) return false;
+
+    // Walk back from the goal; each edge's source is the node whose range holds it
+    for (int32 State = GoalState; ViaEdges[State] != INDEX_NONE;)
+    {
+        const FSwingPoleGraphEdge& Edge = Edges[ViaEdges[State]];
+        OutEdges.Add(Edge);
+
+        const int32 Source = Algo::UpperBound(EdgeOffsets, ViaEdges[State]) - 1;
+        State = Source * NumHangs + FindHangSample(Edge.HangLength);
+    }
+    Algo::Reverse(OutEdges);
+    return true;
+}
@@ -0,0 +1,203 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "SwingPoleGraph.generated.h"
+
+class ACharacter;
+
+/** Swing tuning the graph was baked with — mirrors USwingComponent's settings */
+USTRUCT(BlueprintType)
+struct SWINGGAME_API FSwingReachTuning
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Swing")
+    float AutoSwingForce = 3.7f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Swing")
+    float SwingDamping = 0.988f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Swing")
+    float LaunchSpeedMultiplier = 2.1f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Swing")
+    float MaxSwingAngle = 2.2f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Swing")
+    float GrabDetectionRadius = 220.0f;
+
+    /**
+     * Hang length on the first pole of a course (cm). Grabs hang as far below the
+     * pole as the character was when it grabbed, so later hops carry the hang
+     * their flight arrives with, and graph bakes cover the whole range.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Swing")
+    float HangLength = 120.0f;
+
+    /** Downward gravity magnitude during flight (cm/s²) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Swing")
+    float Gravity = 980.0f;
+
+    /** Amplitude a swing of InHangLength settles at once pumping balances damping, capped by MaxSwingAngle */
+    float GetSteadyAmplitude(float InHangLength) const;
+
+    /** Copies the tuning of SwingerClass's USwingComponent defaults. False if it has none. */
+    bool CopyFromSwinger(TSubclassOf<ACharacter> SwingerClass);
+};
+
+/** One baked pole — a standalone ASwingPole or one entry of an ASwingPoleField */
+USTRUCT(BlueprintType)
+struct SWINGGAME_API FSwingPoleGraphNode
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Swing")
+    FVector Center = FVector::ZeroVector;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Swing")
+    FVector Direction = FVector::RightVector;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Swing")
+    float HalfLength = 0.0f;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Swing")
+    float Reach = 0.0f;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Swing")
+    TObjectPtr<AActor> Owner;
+
+    /** Entry in the owning ASwingPoleField, INDEX_NONE for an ASwingPole */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Swing")
+    int32 InstanceIndex = INDEX_NONE;
+};
+
+/**
+ * Release window from one pole to another. Releasing anywhere inside
+ * [MinReleaseAngle, MaxReleaseAngle] of a steady swing, while swinging in
+ * Direction, flies into the target pole's grab reach.
+ */
+USTRUCT(BlueprintType)
+struct SWINGGAME_API FSwingPoleGraphEdge
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Swing")
+    int32 Target = INDEX_NONE;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Swing")
+    float MinReleaseAngle = 0.0f;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Swing")
+    float MaxReleaseAngle = 0.0f;
+
+    /** Sign of the angular velocity at release: +1 swings toward +X, -1 toward -X */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Swing")
+    int8 Direction = 1;
+
+    /** Flight time from a release in the middle of the window to the first grabbable moment (s) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Swing")
+    float FlightTime = 0.0f;
+
+    /** Hang length on the source pole the window was baked for (cm) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Swing")
+    float HangLength = 0.0f;
+
+    /** Hang length the target pole is grabbed with after that flight (cm) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Swing")
+    float ArrivalHangLength = 0.0f;
+};
+
+/**
+ * Baked pole-to-pole reachability for AI traversal.
+ *
+ * Bake (editor button or the SwingPoleGraph commandlet) gathers every pole in
+ * this actor's level and, for each pair and each of HangLengthSamples hang
+ * lengths, follows releases of a steady pumped swing across the whole arc and
+ * records the angle windows whose ballistic flight reaches the other pole's grab
+ * reach, plus the hang that grab produces. Edges are stored compressed by source
+ * node. At runtime FindPath searches the graph — no trajectory simulation — and
+ * the actor registers itself with USwingPoleSubsystem on BeginPlay.
+ *
+ * Bakes only see geometry: level collision and arc clearance are not considered.
+ */
+UCLASS()
+class SWINGGAME_API ASwingPoleGraph : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    ASwingPoleGraph();
+
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    /** Rebuilds the graph from the poles currently in this actor's level */
+    UFUNCTION(CallInEditor, Category = "Swing")
+    void Bake();
+
+    /** Nearest node whose grab reach (plus Radius) contains Location, or INDEX_NONE */
+    UFUNCTION(BlueprintCallable, Category = "Swing")
+    int32 FindNode(const FVector& Location, float Radius) const;
+
+    /** Node baked from Pole (InstanceIndex for ASwingPoleField entries), or INDEX_NONE */
+    int32 FindNodeForPole(const AActor* Pole, int32 InstanceIndex = INDEX_NONE) const;
+
+    /**
+     * Shortest chain of releases from Start to Goal by total flight time.
+     * OutEdges receives the edge taken out of each pole along the way. Each hop
+     * only uses edges baked for the hang the previous flight arrives with;
+     * StartHangLength is the hang on Start (negative: any baked hang).
+     */
+    UFUNCTION(BlueprintCallable, Category = "Swing")
+    bool FindPath(int32 Start, int32 Goal, TArray<FSwingPoleGraphEdge>& OutEdges, float StartHangLength = -1.0f) const;
+
+    /** Outgoing edges of Node */
+    TConstArrayView<FSwingPoleGraphEdge> GetEdges(int32 Node) const;
+
+    int32 GetNumNodes() const { return Nodes.Num(); }
+    const FSwingPoleGraphNode& GetNode(int32 Node) const { return Nodes[Node]; }
+
+    /**
+     * Computes the release windows from Source, held at HangLength, to Target. Pure
+     * math — the pivot is the point of Source closest to Target, the swing runs in
+     * world XZ like in game.
+     */
+    static void BakeEdges(
+        const FSwingPoleGraphNode& Source, const FSwingPoleGraphNode& Target, int32 TargetIndex,
+        const FSwingReachTuning& Tuning, float HangLength, int32 NumSamples, TArray<FSwingPoleGraphEdge>& OutEdges);
+
+    /** Tuning is read from this character's SwingComponent defaults when set */
+    UPROPERTY(EditAnywhere, Category = "Swing")
+    TSubclassOf<ACharacter> SwingerClass;
+
+    UPROPERTY(EditAnywhere, Category = "Swing")
+    FSwingReachTuning Tuning;
+
+    /** Release angles tried across the arc, per swing direction */
+    UPROPERTY(EditAnywhere, Category = "Swing", meta = (ClampMin = 8))
+    int32 ReleaseSamples = 64;
+
+    /** Hang lengths baked per pole, spread from the shortest grab to the deepest grab reach */
+    UPROPERTY(EditAnywhere, Category = "Swing", meta = (ClampMin = 1, ClampMax = 16))
+    int32 HangLengthSamples = 4;
+
+private:
+    void GatherNodes();
+
+    /** Baked hang length closest to HangLength */
+    int32 FindHangSample(float HangLength) const;
+
+    UPROPERTY(VisibleAnywhere, Category = "Swing|Baked")
+    TArray<float> HangLengths;
+
+    UPROPERTY(VisibleAnywhere, Category = "Swing|Baked")
+    TArray<FSwingPoleGraphNode> Nodes;
+
+    /** Edges of node N are Edges[EdgeOffsets[N] .. EdgeOffsets[N + 1]) */
+    UPROPERTY(VisibleAnywhere, Category = "Swing|Baked")
+    TArray<int32> EdgeOffsets;
+
+    UPROPERTY(VisibleAnywhere, Category = "Swing|Baked")
+    TArray<FSwingPoleGraphEdge> Edges;
+};
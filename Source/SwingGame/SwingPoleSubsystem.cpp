@@ -0,0 +1,252 @@
+#include "SwingPoleSubsystem.h"
+#include "SwingPole.h"
+#include "SwingPoleField.h"
+#include "SwingPoleGraph.h"
+#include "SwingGame.h"
+
+FVector FSwingPoleSegment::GetGrabPoint(const FVector& Location) const
+{
+    const FVector PoleStart = Center - Direction * HalfLength;
+
+    const float T = FMath::Clamp(
+        FVector::DotProduct(Location - PoleStart, Direction),
+        0.0f,
+        HalfLength * 2.0f
+    );
+
+    const FVector Closest = PoleStart + Direction * T;
+    // Keep pole's Z — hands always at pole height
+    return FVector(Closest.X, Closest.Y, Center.Z);
+}
+
+bool USwingPoleSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// ---------------------------------------------------------------------------
+// Registration
+// ---------------------------------------------------------------------------
+
+void USwingPoleSubsystem::RegisterPole(ASwingPole* Pole)
+{
+    if (!IsValid(Pole)) return;
+
+    // Re-registering moves the pole to its current transform
+    RemoveOwner(Pole);
+
+    AddSegment(Pole->GetSegment());
+}
+
+void USwingPoleSubsystem::UnregisterPole(ASwingPole* Pole)
+{
+    RemoveOwner(Pole);
+}
+
+void USwingPoleSubsystem::RegisterField(ASwingPoleField* Field)
+{
+    if (!IsValid(Field)) return;
+
+    RemoveOwner(Field);
+
+    OwnerToSegments.FindOrAdd(Field).Reserve(Field->GetNumPoles());
+    for (int32 Index = 0; Index < Field->GetNumPoles(); ++Index)
+        AddSegment(Field->GetSegment(Index));
+}
+
+void USwingPoleSubsystem::UnregisterField(ASwingPoleField* Field)
+{
+    RemoveOwner(Field);
+}
+
+void USwingPoleSubsystem::RegisterGraph(ASwingPoleGraph* Graph)
+{
+    if (!IsValid(Graph)) return;
+
+    PoleGraphs.RemoveAll([](const TWeakObjectPtr<ASwingPoleGraph>& Registered) { return !Registered.IsValid(); });
+    if (PoleGraphs.Contains(Graph)) return;
+
+    PoleGraphs.Add(Graph);
+    if (PoleGraphs.Num() > 1)
+    {
+        // Graphs don't link up — no path crosses from one level's poles to another's
+        UE_LOG(LogSwingGame, Warning,
+            TEXT("Swing pole graph %s registered alongside %d other(s); GetPoleGraph keeps returning %s, use GetPoleGraphForPole"),
+            *Graph->GetName(), PoleGraphs.Num() - 1, *PoleGraphs[0]->GetName());
+    }
+}
+
+void USwingPoleSubsystem::UnregisterGraph(ASwingPoleGraph* Graph)
+{
+    PoleGraphs.Remove(Graph);
+}
+
+ASwingPoleGraph* USwingPoleSubsystem::GetPoleGraph() const
+{
+    for (const TWeakObjectPtr<ASwingPoleGraph>& Graph : PoleGraphs)
+    {
+        if (Graph.IsValid()) return Graph.Get();
+    }
+    return nullptr;
+}
+
+ASwingPoleGraph* USwingPoleSubsystem::GetPoleGraphForPole(const AActor* Pole, int32 InstanceIndex) const
+{
+    for (const TWeakObjectPtr<ASwingPoleGraph>& Graph : PoleGraphs)
+    {
+        if (Graph.IsValid() && Graph->FindNodeForPole(Pole, InstanceIndex) != INDEX_NONE)
+            return Graph.Get();
+    }
+    return nullptr;
+}
+
+void USwingPoleSubsystem::AddSegment(const FSwingPoleSegment& Segment)
+{
+    const int32 Index = Segments.Add(Segment);
+    Cells.FindOrAdd(GetCell(Segment.Center)).Add(Index);
+    OwnerToSegments.FindOrAdd(Segment.Owner.Get()).Add(Index);
+
+    MaxReach = FMath::Max(MaxReach, Segment.Reach);
+}
+
+void USwingPoleSubsystem::RemoveOwner(const AActor* Owner)
+{
+    TArray<int32> Indices;
+    if (!OwnerToSegments.RemoveAndCopyValue(Owner, Indices)) return;
+
+    for (const int32 Index : Indices)
+    {
+        RemoveFromCell(GetCell(Segments[Index].Center), Index);
+        Segments.RemoveAt(Index);
+    }
+}
+
+void USwingPoleSubsystem::RemoveFromCell(const FIntVector& Cell, int32 Index)
+{
+    if (TArray<int32>* Bucket = Cells.Find(Cell))
+    {
+        Bucket->RemoveSwap(Index);
+        if (Bucket->IsEmpty())
+        {
+            Cells.Remove(Cell);
+        }
+    }
+}
+
+FIntVector USwingPoleSubsystem::GetCell(const FVector& Location)
+{
+    return FIntVector(
+        FMath::FloorToInt(Location.X / CellSize),
+        FMath::FloorToInt(Location.Y / CellSize),
+        FMath::FloorToInt(Location.Z / CellSize));
+}
+
+// ---------------------------------------------------------------------------
+// Queries
+// ---------------------------------------------------------------------------
+
+const FSwingPoleSegment* USwingPoleSubsystem::FindNearestSegment(const FVector& Origin, float Radius) const
+{
+    const float      Range   = Radius + MaxReach;
+    const FIntVector MinCell = GetCell(Origin - FVector(Range));
+    const FIntVector MaxCell = GetCell(Origin + FVector(Range));
+
+    const FSwingPoleSegment* Best     = nullptr;
+    float                    BestDist = TNumericLimits<float>::Max();
+
+    for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+    for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+    for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+    {
+        const TArray<int32>* Bucket = Cells.Find(FIntVector(X, Y, Z));
+        if (!Bucket) continue;
+
+        for (const int32 Index : *Bucket)
+        {
+            const FSwingPoleSegment& Segment = Segments[Index];
+            if (Segment.Center.Z <= Origin.Z) continue;  // must be above
+
+            const float Dist = FVector::Dist(Origin, Segment.Center);
+            if (Dist > Radius + Segment.Reach) continue;
+
+            if (Dist < BestDist) { BestDist = Dist; Best = &Segment; }
+        }
+    }
+
+    return Best;
+}
+
+const FSwingPoleSegment* USwingPoleSubsystem::FindFirstIntercept(
+    const FVector& Origin, const FVector& Velocity, float GravityZ,
+    float Radius, float MaxTime, float& OutTime) const
+{
+    OutTime = -1.0f;
+    if (MaxTime <= 0.0f) return nullptr;
+
+    auto PathAt = [&](float Time)
+    {
+        return Origin + Velocity * Time + FVector(0.0f, 0.0f, 0.5f * GravityZ * Time * Time);
+    };
+
+    // Bounds of the arc: both ends plus the apex when it falls inside the window
+    FBox PathBounds(PathAt(0.0f), PathAt(0.0f));
+    PathBounds += PathAt(MaxTime);
+    if (GravityZ < 0.0f)
+    {
+        const float ApexTime = -Velocity.Z / GravityZ;
+        if (ApexTime > 0.0f && ApexTime < MaxTime) PathBounds += PathAt(ApexTime);
+    }
+    PathBounds = PathBounds.ExpandBy(Radius + MaxReach);
+
+    const FIntVector MinCell = GetCell(PathBounds.Min);
+    const FIntVector MaxCell = GetCell(PathBounds.Max);
+
+    // Coarse samples bracket the first entry, bisection pins it down
+    constexpr int32 NumSamples     = 16;
+    constexpr int32 NumBisections  = 8;
+    const float     SampleInterval = MaxTime / NumSamples;
+
+    const FSwingPoleSegment* Best     = nullptr;
+    float                    BestTime = MaxTime;
+
+    for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+    for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+    for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+    {
+        const TArray<int32>* Bucket = Cells.Find(FIntVector(X, Y, Z));
+        if (!Bucket) continue;
+
+        for (const int32 Index : *Bucket)
+        {
+            const FSwingPoleSegment& Segment = Segments[Index];
+            const float RangeSq = FMath::Square(Radius + Segment.Reach);
+
+            // Same rule as FindNearestSegment: pole above and centre within range
+            auto IsGrabbable = [&](float Time)
+            {
+                const FVector Offset = PathAt(Time) - Segment.Center;
+                return Offset.Z < 0.0f && Offset.SizeSquared() <= RangeSq;
+            };
+
+            for (int32 Sample = 0; Sample <= NumSamples; ++Sample)
+            {
+                float Hi = Sample * SampleInterval;
+                if (Hi > BestTime) break;
+                if (!IsGrabbable(Hi)) continue;
+
+                float Lo = FMath::Max(Hi - SampleInterval, 0.0f);
+                for (int32 Step = 0; Sample > 0 && Step < NumBisections; ++Step)
+                {
+                    const float Mid = 0.5f * (Lo + Hi);
+                    (IsGrabbable(Mid) ? Hi : Lo) = Mid;
+                }
+
+                if (!Best || Hi < BestTime) { BestTime = Hi; Best = &Segment; }
+                break;
+            }
+        }
+    }
+
+    if (Best) OutTime = BestTime;
+    return Best;
+}
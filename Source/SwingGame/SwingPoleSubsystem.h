@@ -0,0 +1,122 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SwingPoleSubsystem.generated.h"
+
+class ASwingPole;
+class ASwingPoleField;
+class ASwingPoleGraph;
+
+/**
+ * Grab segment of a single pole as stored in the registry.
+ * Mirrors the geometry ASwingPole::GetGrabPoint works on, so grab points can be
+ * resolved without touching the actor. Comes from either an ASwingPole or one
+ * entry of an ASwingPoleField.
+ */
+struct SWINGGAME_API FSwingPoleSegment
+{
+    /** Centre of the pole (actor location) */
+    FVector Center = FVector::ZeroVector;
+
+    /** Unit axis of the pole (actor right vector) */
+    FVector Direction = FVector::RightVector;
+
+    /** Half-length of the pole along Direction (cm) */
+    float HalfLength = 0.0f;
+
+    /** Extra reach around Center — matches the old GrabTrigger sphere radius */
+    float Reach = 0.0f;
+
+    /** ASwingPole or ASwingPoleField the segment belongs to */
+    TWeakObjectPtr<AActor> Owner;
+
+    /** Entry in the owning ASwingPoleField, INDEX_NONE for an ASwingPole */
+    int32 InstanceIndex = INDEX_NONE;
+
+    /** Closest point on the segment to Location, at the pole's own height */
+    FVector GetGrabPoint(const FVector& Location) const;
+};
+
+/**
+ * Spatial registry of every ASwingPole and ASwingPoleField pole in the world.
+ * Poles register themselves on BeginPlay into a uniform grid; SwingComponent
+ * queries it on grab instead of running a physics overlap, so grab cost only
+ * depends on the number of poles nearby.
+ */
+UCLASS()
+class SWINGGAME_API USwingPoleSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Adds the pole's current segment to the grid, or refreshes it if already registered */
+    void RegisterPole(ASwingPole* Pole);
+
+    void UnregisterPole(ASwingPole* Pole);
+
+    /** Adds every pole of the field, replacing what it registered before */
+    void RegisterField(ASwingPoleField* Field);
+
+    void UnregisterField(ASwingPoleField* Field);
+
+    /**
+     * Returns the nearest pole segment above Origin whose centre is within
+     * Radius + segment Reach, or nullptr. The pointer is valid until the
+     * registry is next modified.
+     */
+    const FSwingPoleSegment* FindNearestSegment(const FVector& Origin, float Radius) const;
+
+    /**
+     * Follows the ballistic path Origin + Velocity·t + ½·(0, 0, GravityZ)·t² for up to
+     * MaxTime seconds and returns the segment FindNearestSegment would first report
+     * along it, with the time it becomes grabbable in OutTime. Pure math over the
+     * registry — no scene queries. Returns nullptr if nothing is reached in time.
+     */
+    const FSwingPoleSegment* FindFirstIntercept(
+        const FVector& Origin, const FVector& Velocity, float GravityZ,
+        float Radius, float MaxTime, float& OutTime) const;
+
+    int32 GetNumPoles() const { return Segments.Num(); }
+
+    /** Baked reachability graph of a level, added by ASwingPoleGraph on BeginPlay */
+    void RegisterGraph(ASwingPoleGraph* Graph);
+
+    void UnregisterGraph(ASwingPoleGraph* Graph);
+
+    /** First registered graph, or nullptr when no level has one baked */
+    ASwingPoleGraph* GetPoleGraph() const;
+
+    /**
+     * Graph holding Pole (InstanceIndex for ASwingPoleField entries), or nullptr.
+     * Each graph covers its own level — with several loaded, search the start pole's.
+     */
+    ASwingPoleGraph* GetPoleGraphForPole(const AActor* Pole, int32 InstanceIndex = INDEX_NONE) const;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    static FIntVector GetCell(const FVector& Location);
+
+    void AddSegment(const FSwingPoleSegment& Segment);
+    void RemoveOwner(const AActor* Owner);
+    void RemoveFromCell(const FIntVector& Cell, int32 Index);
+
+    /** Grid cell edge length (cm) */
+    static constexpr float CellSize = 500.0f;
+
+    TSparseArray<FSwingPoleSegment> Segments;
+
+    /** Segment indices bucketed by the cell containing the segment centre */
+    TMap<FIntVector, TArray<int32>> Cells;
+
+    /** Segment indices registered by each pole or field actor */
+    TMap<TObjectKey<AActor>, TArray<int32>> OwnerToSegments;
+
+    /** Largest Reach of any registered segment — widens the cell search */
+    float MaxReach = 0.0f;
+
+    /** In registration order */
+    TArray<TWeakObjectPtr<ASwingPoleGraph>> PoleGraphs;
+};
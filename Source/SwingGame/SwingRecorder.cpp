@@ -0,0 +1,274 @@
+#include "SwingRecorder.h"
+#include "SwingComponent.h"
+#include "SwingSimulationSubsystem.h"
+#include "SwingGame.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/UObjectIterator.h"
+
+namespace SwingRecord
+{
+    constexpr uint32 Magic   = 0x53575243;  // "SWRC"
+    constexpr uint32 Version = 1;
+
+    constexpr float AngleScale           = 32767.0f / UE_PI;
+    constexpr float AngularVelocityScale = 1024.0f;
+    constexpr float PivotStep            = 2.0f;
+    constexpr int32 PivotBits            = 20;
+    constexpr int32 PivotMax             = (1 << (PivotBits - 1)) - 1;
+
+    int16 QuantizeSigned(float Value, float Scale)
+    {
+        return static_cast<int16>(FMath::Clamp(FMath::RoundToInt(Value * Scale), -32767, 32767));
+    }
+
+    uint16 QuantizeUnsigned(float Value, float Scale)
+    {
+        return static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(Value * Scale), 0, 65535));
+    }
+
+    uint64 PackAxis(double Value)
+    {
+        const int32 Quantized = FMath::Clamp(FMath::RoundToInt32(Value / PivotStep), -PivotMax, PivotMax);
+        return static_cast<uint64>(Quantized) & ((1ull << PivotBits) - 1);
+    }
+
+    float UnpackAxis(uint64 Packed, int32 Shift)
+    {
+        // Sign-extend the 20-bit field
+        const int32 Bits = static_cast<int32>((Packed >> Shift) & ((1ull << PivotBits) - 1));
+        return (static_cast<int32>(static_cast<uint32>(Bits) << (32 - PivotBits)) >> (32 - PivotBits)) * PivotStep;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Sample
+// ---------------------------------------------------------------------------
+
+FSwingRecordSample FSwingRecordSample::MakeState(
+    uint8 State, bool bJumpPressed, float InAngle, float InAngularVelocity,
+    const FVector& Pivot, float InHangLength, float InDeltaTime)
+{
+    using namespace SwingRecord;
+
+    FSwingRecordSample Sample;
+    Sample.Packed = PackAxis(Pivot.X)
+        | (PackAxis(Pivot.Y) << PivotBits)
+        | (PackAxis(Pivot.Z) << (PivotBits * 2))
+        | (static_cast<uint64>(State) & 0x3) << 60
+        | static_cast<uint64>(bJumpPressed) << 62;
+    Sample.Angle           = QuantizeSigned(FMath::UnwindRadians(InAngle), AngleScale);
+    Sample.AngularVelocity = QuantizeSigned(InAngularVelocity, AngularVelocityScale);
+    Sample.HangLength      = QuantizeUnsigned(InHangLength, 32.0f);
+    Sample.DeltaTime       = QuantizeUnsigned(InDeltaTime, 32768.0f);
+    return Sample;
+}
+
+FSwingRecordSample FSwingRecordSample::MakeLimits(
+    float MinAngle, float MaxAngle, float MinRestitution, float MaxRestitution, float InHangLength)
+{
+    using namespace SwingRecord;
+
+    FSwingRecordSample Sample;
+    Sample.Packed          = 1ull << 63
+        | static_cast<uint64>(FMath::RoundToInt(FMath::Clamp(MinRestitution, 0.0f, 1.0f) * 255.0f))
+        | static_cast<uint64>(FMath::RoundToInt(FMath::Clamp(MaxRestitution, 0.0f, 1.0f) * 255.0f)) << 8;
+    Sample.Angle           = QuantizeSigned(MinAngle, AngleScale);
+    Sample.AngularVelocity = QuantizeSigned(MaxAngle, AngleScale);
+    Sample.HangLength      = QuantizeUnsigned(InHangLength, 32.0f);
+    return Sample;
+}
+
+float FSwingRecordSample::GetAngle() const
+{
+    return Angle / SwingRecord::AngleScale;
+}
+
+float FSwingRecordSample::GetAngularVelocity() const
+{
+    return AngularVelocity / SwingRecord::AngularVelocityScale;
+}
+
+float FSwingRecordSample::GetMaxAngle() const
+{
+    return AngularVelocity / SwingRecord::AngleScale;
+}
+
+FVector FSwingRecordSample::GetPivot() const
+{
+    using namespace SwingRecord;
+    return FVector(UnpackAxis(Packed, 0), UnpackAxis(Packed, PivotBits), UnpackAxis(Packed, PivotBits * 2));
+}
+
+// ---------------------------------------------------------------------------
+// Ring buffer
+// ---------------------------------------------------------------------------
+
+void FSwingRecorder::Init(int32 InCapacity)
+{
+    Capacity = FMath::Max(InCapacity, 0);
+    Head     = 0;
+    Count    = 0;
+    Samples.SetNumUninitialized(Capacity);
+}
+
+void FSwingRecorder::Add(const FSwingRecordSample& Sample)
+{
+    if (Capacity == 0) return;
+
+    Samples[Head] = Sample;
+    Head  = (Head + 1) % Capacity;
+    Count = FMath::Min(Count + 1, Capacity);
+}
+
+bool FSwingRecorder::SaveToFile(const FString& Filename, const FSwingRecordHeader& Header) const
+{
+    TArray<uint8> Bytes;
+    FMemoryWriter Writer(Bytes);
+
+    uint32 Magic   = SwingRecord::Magic;
+    uint32 Version = SwingRecord::Version;
+    int32  Num     = Count;
+    FSwingRecordHeader Tuning = Header;
+    Writer << Magic << Version
+           << Tuning.AutoSwingForce << Tuning.SwingDamping << Tuning.FixedStep << Tuning.MaxSubsteps
+           << Num;
+
+    // Oldest sample first
+    const int32 First = (Head - Count + Capacity) % FMath::Max(Capacity, 1);
+    for (int32 Offset = 0; Offset < Count; ++Offset)
+    {
+        const FSwingRecordSample& Sample = Samples[(First + Offset) % Capacity];
+        Writer.Serialize(const_cast<FSwingRecordSample*>(&Sample), sizeof(FSwingRecordSample));
+    }
+
+    return FFileHelper::SaveArrayToFile(Bytes, *Filename);
+}
+
+bool FSwingRecorder::LoadFromFile(const FString& Filename, FSwingRecordHeader& OutHeader,
+                                  TArray<FSwingRecordSample>& OutSamples)
+{
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *Filename)) return false;
+
+    FMemoryReader Reader(Bytes);
+
+    uint32 Magic = 0, Version = 0;
+    int32  Num   = 0;
+    Reader << Magic << Version;
+    if (Magic != SwingRecord::Magic || Version != SwingRecord::Version) return false;
+
+    Reader << OutHeader.AutoSwingForce << OutHeader.SwingDamping << OutHeader.FixedStep << OutHeader.MaxSubsteps
+           << Num;
+    if (Num < 0 || Reader.TotalSize() - Reader.Tell() < int64(Num) * int64(sizeof(FSwingRecordSample))) return false;
+
+    OutSamples.SetNumUninitialized(Num);
+    Reader.Serialize(OutSamples.GetData(), Num * sizeof(FSwingRecordSample));
+    return !Reader.IsError();
+}
+
+// ---------------------------------------------------------------------------
+// Replay
+// ---------------------------------------------------------------------------
+
+FSwingReplayResult ReplaySwingRecording(
+    const FSwingRecordHeader& Header, const TArray<FSwingRecordSample>& Samples)
+{
+    FSwingReplayResult Result;
+    const double StartTime = FPlatformTime::Seconds();
+
+    float MinAngle = -UE_PI, MaxAngle = UE_PI, MinRestitution = 0.0f, MaxRestitution = 0.0f;
+    float Angle = 0.0f, AngularVelocity = 0.0f, PrevAngle = 0.0f, Accumulator = 0.0f;
+    bool  bSeeded = false;
+
+    for (const FSwingRecordSample& Sample : Samples)
+    {
+        if (Sample.IsLimits())
+        {
+            MinAngle       = Sample.GetMinAngle();
+            MaxAngle       = Sample.GetMaxAngle();
+            MinRestitution = Sample.GetMinRestitution();
+            MaxRestitution = Sample.GetMaxRestitution();
+            bSeeded        = false;
+            continue;
+        }
+
+        if (Sample.GetState() != static_cast<uint8>(ESwingState::Swinging))
+        {
+            bSeeded = false;
+            continue;
+        }
+
+        if (!bSeeded)
+        {
+            // First tick of a swing: nothing stepped yet, take the recorded state as is
+            Angle           = Sample.GetAngle();
+            AngularVelocity = Sample.GetAngularVelocity();
+            PrevAngle       = Angle;
+            Accumulator     = 0.0f;
+            bSeeded         = true;
+            ++Result.NumSwings;
+            continue;
+        }
+
+        USwingSimulationSubsystem::AdvancePendulum(
+            Angle, AngularVelocity, PrevAngle, Accumulator,
+            Sample.GetHangLength(), Header.AutoSwingForce, Header.SwingDamping, MinAngle, MaxAngle,
+            Header.FixedStep, Header.MaxSubsteps, Sample.GetDeltaTime(), MinRestitution, MaxRestitution);
+
+        Result.MaxAngleError = FMath::Max(Result.MaxAngleError, FMath::Abs(Angle - Sample.GetAngle()));
+        ++Result.NumSteps;
+    }
+
+    Result.Seconds = FPlatformTime::Seconds() - StartTime;
+    return Result;
+}
+
+// ---------------------------------------------------------------------------
+// Console
+// ---------------------------------------------------------------------------
+
+static FAutoConsoleCommandWithWorldAndArgs GSwingDumpRecordings(
+    TEXT("Swing.DumpRecordings"),
+    TEXT("Writes the swing recording of every USwingComponent in the world to Saved/SwingRecordings"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        const FString Directory = FPaths::ProjectSavedDir() / TEXT("SwingRecordings");
+        const FString Stamp     = FDateTime::Now().ToString();
+
+        for (TObjectIterator<USwingComponent> It; It; ++It)
+        {
+            if (It->GetWorld() != World || !It->GetOwner()) continue;
+
+            const FString Filename = Directory / FString::Printf(
+                TEXT("%s_%s.swingrec"), *It->GetOwner()->GetName(), *Stamp);
+            if (It->DumpRecording(Filename))
+                UE_LOG(LogSwingGame, Log, TEXT("Swing recording written to %s"), *Filename);
+        }
+    }));
+
+static FAutoConsoleCommand GSwingReplay(
+    TEXT("Swing.Replay"),
+    TEXT("Swing.Replay <file> — runs a swing recording back through the pendulum integrator"),
+    FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+    {
+        if (Args.IsEmpty()) return;
+
+        FSwingRecordHeader         Header;
+        TArray<FSwingRecordSample> Samples;
+        if (!FSwingRecorder::LoadFromFile(Args[0], Header, Samples))
+        {
+            UE_LOG(LogSwingGame, Warning, TEXT("Could not read swing recording %s"), *Args[0]);
+            return;
+        }
+
+        const FSwingReplayResult Result = ReplaySwingRecording(Header, Samples);
+        UE_LOG(LogSwingGame, Log,
+            TEXT("Swing replay %s: %d samples, %d swings, %d steps, max angle error %.4f rad, %.3f ms"),
+            *Args[0], Samples.Num(), Result.NumSwings, Result.NumSteps, Result.MaxAngleError,
+            Result.Seconds * 1000.0);
+    }));
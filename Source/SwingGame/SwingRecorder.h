@@ -0,0 +1,105 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * One recorded swing tick, quantized to 16 bytes.
+ *   Pivot             3 × 20 bit, 2 cm steps (±10 km)
+ *   Angle             π / 32767 rad steps
+ *   AngularVelocity   1/1024 rad/s steps (±32 rad/s)
+ *   HangLength        1/32 cm steps (up to 20 m)
+ *   DeltaTime         1/32768 s steps (up to 2 s)
+ * Limits samples are written when a swing starts and carry the swing's clamp
+ * interval in the Angle / AngularVelocity slots instead of state, and each
+ * limit's restitution in the low 16 bits of the packed word (1/255 steps).
+ * State is an ESwingState value.
+ */
+struct SWINGGAME_API FSwingRecordSample
+{
+    static FSwingRecordSample MakeState(
+        uint8 State, bool bJumpPressed, float Angle, float AngularVelocity,
+        const FVector& Pivot, float HangLength, float DeltaTime);
+
+    static FSwingRecordSample MakeLimits(
+        float MinAngle, float MaxAngle, float MinRestitution, float MaxRestitution, float HangLength);
+
+    uint8 GetState() const         { return static_cast<uint8>((Packed >> 60) & 0x3); }
+    bool IsJumpPressed() const     { return (Packed >> 62) & 0x1; }
+    bool IsLimits() const          { return (Packed >> 63) & 0x1; }
+
+    float   GetAngle() const;
+    float   GetAngularVelocity() const;
+    FVector GetPivot() const;
+    float   GetHangLength() const  { return HangLength / 32.0f; }
+    float   GetDeltaTime() const   { return DeltaTime / 32768.0f; }
+
+    /** Only meaningful on limits samples */
+    float GetMinAngle() const      { return GetAngle(); }
+    float GetMaxAngle() const;
+    float GetMinRestitution() const { return (Packed & 0xFF) / 255.0f; }
+    float GetMaxRestitution() const { return ((Packed >> 8) & 0xFF) / 255.0f; }
+
+private:
+    uint64 Packed          = 0;
+    int16  Angle           = 0;
+    int16  AngularVelocity = 0;
+    uint16 HangLength      = 0;
+    uint16 DeltaTime       = 0;
+};
+
+static_assert(sizeof(FSwingRecordSample) == 16, "Swing record samples are meant to stay 16 bytes");
+
+/** Tuning a recording was made with — everything the integrator needs besides the samples */
+struct SWINGGAME_API FSwingRecordHeader
+{
+    float AutoSwingForce = 0.0f;
+    float SwingDamping   = 0.0f;
+    float FixedStep      = 0.0f;
+    int32 MaxSubsteps    = 0;
+};
+
+/**
+ * Fixed-size ring buffer of swing samples. Memory is allocated once; when full,
+ * the oldest samples are overwritten.
+ */
+class SWINGGAME_API FSwingRecorder
+{
+public:
+    void Init(int32 InCapacity);
+
+    bool IsEnabled() const { return Capacity > 0; }
+    int32 Num() const      { return Count; }
+
+    void Add(const FSwingRecordSample& Sample);
+
+    /** Writes header and samples (oldest first) to Filename */
+    bool SaveToFile(const FString& Filename, const FSwingRecordHeader& Header) const;
+
+    static bool LoadFromFile(const FString& Filename, FSwingRecordHeader& OutHeader,
+                             TArray<FSwingRecordSample>& OutSamples);
+
+private:
+    TArray<FSwingRecordSample> Samples;
+    int32 Capacity = 0;
+    int32 Head     = 0;
+    int32 Count    = 0;
+};
+
+/** Result of running a recording back through the pendulum integrator */
+struct SWINGGAME_API FSwingReplayResult
+{
+    int32  NumSwings     = 0;
+    int32  NumSteps      = 0;
+    float  MaxAngleError = 0.0f;
+    double Seconds       = 0.0;
+};
+
+/**
+ * Replays every swing of a recording through USwingSimulationSubsystem's
+ * integrator — no world, no actors. Each swing is seeded from its first sample
+ * and stepped with the recorded frame times; the result reports how far the
+ * simulation drifts from what was recorded and how long stepping took.
+ * Swings that spent time in swing LOD are not reproduced exactly.
+ */
+SWINGGAME_API FSwingReplayResult ReplaySwingRecording(
+    const FSwingRecordHeader& Header, const TArray<FSwingRecordSample>& Samples);
@@ -0,0 +1,361 @@
+#include "SwingSimulationSubsystem.h"
+#include "SwingComponent.h"
+#include "SwingPendulumKernel.h"
+#include "GameFramework/Character.h"
+#include "Async/ParallelFor.h"
+
+// ---------------------------------------------------------------------------
+// Pendulum step
+// ---------------------------------------------------------------------------
+
+void USwingSimulationSubsystem::StepPendulum(
+    float& Angle, float& AngularVelocity,
+    float HangLength, float AutoSwingForce, float Damping, float MinAngle, float MaxAngle,
+    float DeltaTime, float MinRestitution, float MaxRestitution)
+{
+    FSwingPendulumKernel::Step(
+        Angle, AngularVelocity, HangLength, AutoSwingForce, Damping, MinAngle, MaxAngle,
+        DeltaTime, MinRestitution, MaxRestitution);
+}
+
+int32 USwingSimulationSubsystem::ConsumeFixedSteps(
+    float& Accumulator, float FixedStep, int32 MaxSubsteps, float DeltaTime)
+{
+    Accumulator += DeltaTime;
+
+    int32 Steps = FMath::FloorToInt(Accumulator / FixedStep);
+    if (Steps > MaxSubsteps)
+    {
+        // Hitch: run the budget and forget the rest rather than spiral
+        Steps       = MaxSubsteps;
+        Accumulator = FixedStep * Steps;
+    }
+    Accumulator -= FixedStep * Steps;
+    return Steps;
+}
+
+float USwingSimulationSubsystem::AdvancePendulum(
+    float& Angle, float& AngularVelocity, float& PrevAngle, float& Accumulator,
+    float HangLength, float AutoSwingForce, float Damping, float MinAngle, float MaxAngle,
+    float FixedStep, int32 MaxSubsteps, float DeltaTime,
+    float MinRestitution, float MaxRestitution)
+{
+    if (FixedStep <= 0.0f)
+    {
+        StepPendulum(Angle, AngularVelocity, HangLength, AutoSwingForce, Damping, MinAngle, MaxAngle,
+                     DeltaTime, MinRestitution, MaxRestitution);
+        PrevAngle = Angle;
+        return Angle;
+    }
+
+    const int32 Steps = ConsumeFixedSteps(Accumulator, FixedStep, MaxSubsteps, DeltaTime);
+    for (int32 Step = 0; Step < Steps; ++Step)
+    {
+        PrevAngle = Angle;
+        StepPendulum(Angle, AngularVelocity, HangLength, AutoSwingForce, Damping, MinAngle, MaxAngle,
+                     FixedStep, MinRestitution, MaxRestitution);
+    }
+
+    return FMath::Lerp(PrevAngle, Angle, Accumulator / FixedStep);
+}
+
+FVector USwingSimulationSubsystem::GetTangentVelocity(float Angle, float AngularVelocity, float HangLength)
+{
+    // d/dt of Pivot + (sin θ, 0, -cos θ) * L
+    return FVector(FMath::Cos(Angle), 0.0f, FMath::Sin(Angle)) * (HangLength * AngularVelocity);
+}
+
+// ---------------------------------------------------------------------------
+// Registration
+// ---------------------------------------------------------------------------
+
+bool USwingSimulationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId USwingSimulationSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USwingSimulationSubsystem, STATGROUP_Tickables);
+}
+
+void USwingSimulationSubsystem::AddSwinger(USwingComponent* Swinger)
+{
+    if (!IsValid(Swinger) || Swinger->SimIndex != INDEX_NONE) return;
+
+    Swinger->SimIndex = Swingers.Add(Swinger);
+
+    Angles.Add(Swinger->SwingAngle);
+    AngularVelocities.Add(Swinger->SwingAngularVelocity);
+    HangLengths.Add(Swinger->HangLength);
+    AutoSwingForces.Add(Swinger->AutoSwingForce);
+    Dampings.Add(Swinger->SwingDamping);
+    DampingLog2s.Add(FSwingPendulumKernel::GetDampingLog2(Swinger->SwingDamping));
+    MinAngles.Add(Swinger->SwingMinAngle);
+    MaxAngles.Add(Swinger->SwingMaxAngle);
+    MinRestitutions.Add(Swinger->SwingMinRestitution);
+    MaxRestitutions.Add(Swinger->SwingMaxRestitution);
+    Pivots.Add(Swinger->PivotWorldLocation);
+    FixedSteps.Add(Swinger->GetFixedStep());
+    SubstepLimits.Add(Swinger->MaxSubstepsPerFrame);
+    Accumulators.Add(Swinger->FixedStepAccumulator);
+    PrevAngles.Add(Swinger->PrevSwingAngle);
+    Positions.Add(Swinger->OwnerCharacter->GetActorLocation());
+    Velocities.Add(Swinger->CachedSwingVelocity);
+
+    const float LODInterval = Swinger->bEnableSwingLOD ? Swinger->SwingLODInterval : 0.0f;
+    LODStates.AddDefaulted();
+    LODIntervals.Add(LODInterval);
+    LODPendingTimes.Add(0.0f);
+    // Stagger significance checks so a wave of grabs doesn't check all at once
+    SignificanceTimers.Add(FMath::FRandRange(0.0f, LODInterval));
+    CommitDeltaTimes.Add(-1.0f);
+}
+
+void USwingSimulationSubsystem::RemoveSwinger(USwingComponent* Swinger)
+{
+    if (!Swinger || !Swingers.IsValidIndex(Swinger->SimIndex)) return;
+    if (Swingers[Swinger->SimIndex] != Swinger) return;
+
+    const int32 Index = Swinger->SimIndex;
+
+    // Catch up before handing the state back — release launches from it
+    if (LODStates[Index].IsActive())
+    {
+        ExitLOD(Index);
+        Swinger->CommitSimulatedSwing(
+            Angles[Index], AngularVelocities[Index], PrevAngles[Index], Accumulators[Index],
+            Positions[Index], Velocities[Index], 0.0f);
+    }
+
+    RemoveAtSwap(Index);
+    Swinger->SimIndex = INDEX_NONE;
+}
+
+void USwingSimulationSubsystem::SetSwingerState(USwingComponent* Swinger, float Angle, float AngularVelocity)
+{
+    if (!Swinger || !Swingers.IsValidIndex(Swinger->SimIndex)) return;
+    if (Swingers[Swinger->SimIndex] != Swinger) return;
+
+    const int32 Index = Swinger->SimIndex;
+    if (LODStates[Index].IsActive())
+        ExitLOD(Index);
+
+    Angles[Index]            = Angle;
+    AngularVelocities[Index] = AngularVelocity;
+    PrevAngles[Index]        = Angle;
+    Velocities[Index]        = GetTangentVelocity(Angle, AngularVelocity, HangLengths[Index]);
+}
+
+void USwingSimulationSubsystem::RemoveAtSwap(int32 Index)
+{
+    Swingers.RemoveAtSwap(Index, EAllowShrinking::No);
+    Angles.RemoveAtSwap(Index, EAllowShrinking::No);
+    AngularVelocities.RemoveAtSwap(Index, EAllowShrinking::No);
+    HangLengths.RemoveAtSwap(Index, EAllowShrinking::No);
+    AutoSwingForces.RemoveAtSwap(Index, EAllowShrinking::No);
+    Dampings.RemoveAtSwap(Index, EAllowShrinking::No);
+    DampingLog2s.RemoveAtSwap(Index, EAllowShrinking::No);
+    MinAngles.RemoveAtSwap(Index, EAllowShrinking::No);
+    MaxAngles.RemoveAtSwap(Index, EAllowShrinking::No);
+    MinRestitutions.RemoveAtSwap(Index, EAllowShrinking::No);
+    MaxRestitutions.RemoveAtSwap(Index, EAllowShrinking::No);
+    Pivots.RemoveAtSwap(Index, EAllowShrinking::No);
+    FixedSteps.RemoveAtSwap(Index, EAllowShrinking::No);
+    SubstepLimits.RemoveAtSwap(Index, EAllowShrinking::No);
+    Accumulators.RemoveAtSwap(Index, EAllowShrinking::No);
+    PrevAngles.RemoveAtSwap(Index, EAllowShrinking::No);
+    Positions.RemoveAtSwap(Index, EAllowShrinking::No);
+    Velocities.RemoveAtSwap(Index, EAllowShrinking::No);
+    LODStates.RemoveAtSwap(Index, EAllowShrinking::No);
+    LODIntervals.RemoveAtSwap(Index, EAllowShrinking::No);
+    LODPendingTimes.RemoveAtSwap(Index, EAllowShrinking::No);
+    SignificanceTimers.RemoveAtSwap(Index, EAllowShrinking::No);
+    CommitDeltaTimes.RemoveAtSwap(Index, EAllowShrinking::No);
+
+    // The last swinger now lives at Index
+    if (Swingers.IsValidIndex(Index) && Swingers[Index])
+    {
+        Swingers[Index]->SimIndex = Index;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Tick
+// ---------------------------------------------------------------------------
+
+void USwingSimulationSubsystem::Tick(float DeltaTime)
+{
+    // Drop swingers whose component or character went away without releasing
+    for (int32 i = Swingers.Num() - 1; i >= 0; --i)
+    {
+        if (!IsValid(Swingers[i]) || !Swingers[i]->OwnerCharacter)
+        {
+            RemoveAtSwap(i);
+        }
+    }
+
+    if (Swingers.IsEmpty()) return;
+
+    UpdateSignificance(DeltaTime);
+    Simulate(DeltaTime);
+    Commit();
+}
+
+void USwingSimulationSubsystem::UpdateSignificance(float DeltaTime)
+{
+    for (int32 i = 0; i < Swingers.Num(); ++i)
+    {
+        if (LODIntervals[i] <= 0.0f) continue;
+
+        SignificanceTimers[i] -= DeltaTime;
+        if (SignificanceTimers[i] > 0.0f) continue;
+        SignificanceTimers[i] = LODIntervals[i];
+
+        const bool bSignificant = Swingers[i]->IsSwingSignificant();
+
+        if (!bSignificant && !LODStates[i].IsActive())
+        {
+            LODStates[i].Enter(
+                Angles[i], AngularVelocities[i],
+                HangLengths[i], AutoSwingForces[i], Dampings[i], MinAngles[i], MaxAngles[i],
+                MinRestitutions[i], MaxRestitutions[i], FixedSteps[i] > 0.0f ? FixedSteps[i] : DeltaTime);
+            LODPendingTimes[i] = 0.0f;
+        }
+        else if (bSignificant && LODStates[i].IsActive())
+        {
+            ExitLOD(i);
+        }
+    }
+}
+
+void USwingSimulationSubsystem::ExitLOD(int32 Index)
+{
+    // Fold in time not yet seen by the envelope, then replay exactly
+    float EstimatedAngle, EstimatedAngularVelocity;
+    LODStates[Index].Advance(LODPendingTimes[Index], EstimatedAngle, EstimatedAngularVelocity);
+    LODPendingTimes[Index] = 0.0f;
+
+    LODStates[Index].Exit(Angles[Index], AngularVelocities[Index]);
+    PrevAngles[Index]   = Angles[Index];
+    Accumulators[Index] = 0.0f;
+
+    float Sin, Cos;
+    FMath::SinCos(&Sin, &Cos, Angles[Index]);
+    Positions[Index]  = Pivots[Index] + FVector(Sin, 0.0f, -Cos) * HangLengths[Index];
+    Velocities[Index] = GetTangentVelocity(Angles[Index], AngularVelocities[Index], HangLengths[Index]);
+}
+
+void USwingSimulationSubsystem::Simulate(float DeltaTime)
+{
+    const int32 Num        = Swingers.Num();
+    const int32 NumBatches = FMath::DivideAndRoundUp(Num, BatchSize);
+
+    ParallelFor(NumBatches, [this, Num, DeltaTime](int32 Batch)
+    {
+        const int32 Start = Batch * BatchSize;
+        const int32 Count = FMath::Min(Start + BatchSize, Num) - Start;
+
+        // Steps this frame and their length per swinger — LOD swingers sit out
+        int32 StepCounts[BatchSize];
+        float StepTimes[BatchSize];
+        int32 MaxSteps = 0;
+
+        for (int32 Lane = 0; Lane < Count; ++Lane)
+        {
+            const int32 i = Start + Lane;
+            StepCounts[Lane] = 0;
+            StepTimes[Lane]  = 0.0f;
+
+            if (LODStates[i].IsActive())
+            {
+                // Insignificant: evaluate the closed form a few times a second
+                LODPendingTimes[i] += DeltaTime;
+                if (LODPendingTimes[i] < LODIntervals[i])
+                {
+                    CommitDeltaTimes[i] = -1.0f;
+                    continue;
+                }
+
+                CommitDeltaTimes[i] = LODPendingTimes[i];
+                LODStates[i].Advance(LODPendingTimes[i], Angles[i], AngularVelocities[i]);
+                LODPendingTimes[i] = 0.0f;
+                continue;
+            }
+
+            CommitDeltaTimes[i] = DeltaTime;
+            if (FixedSteps[i] > 0.0f)
+            {
+                StepCounts[Lane] = ConsumeFixedSteps(Accumulators[i], FixedSteps[i], SubstepLimits[i], DeltaTime);
+                StepTimes[Lane]  = FixedSteps[i];
+            }
+            else
+            {
+                StepCounts[Lane] = 1;
+                StepTimes[Lane]  = DeltaTime;
+            }
+            MaxSteps = FMath::Max(MaxSteps, StepCounts[Lane]);
+        }
+
+        // Integrate the batch one step at a time; swingers out of steps get a zero step
+        float LaneTimes[BatchSize];
+        for (int32 Step = 0; Step < MaxSteps; ++Step)
+        {
+            for (int32 Lane = 0; Lane < Count; ++Lane)
+            {
+                const bool bSteps = StepCounts[Lane] > Step;
+                LaneTimes[Lane] = bSteps ? StepTimes[Lane] : 0.0f;
+                if (bSteps) PrevAngles[Start + Lane] = Angles[Start + Lane];
+            }
+
+            FSwingPendulumKernel::StepBatch(
+                Angles.GetData() + Start, AngularVelocities.GetData() + Start,
+                HangLengths.GetData() + Start, AutoSwingForces.GetData() + Start, DampingLog2s.GetData() + Start,
+                MinAngles.GetData() + Start, MaxAngles.GetData() + Start,
+                MinRestitutions.GetData() + Start, MaxRestitutions.GetData() + Start, LaneTimes, Count);
+        }
+
+        for (int32 i = Start; i < Start + Count; ++i)
+        {
+            if (CommitDeltaTimes[i] < 0.0f) continue;
+
+            float RenderAngle = Angles[i];
+            if (FixedSteps[i] > 0.0f && !LODStates[i].IsActive())
+            {
+                RenderAngle = FMath::Lerp(PrevAngles[i], Angles[i], Accumulators[i] / FixedSteps[i]);
+            }
+            else
+            {
+                PrevAngles[i] = Angles[i];
+            }
+
+            float Sin, Cos;
+            FMath::SinCos(&Sin, &Cos, RenderAngle);
+            const FVector NewPos = Pivots[i] + FVector(Sin, 0.0f, -Cos) * HangLengths[i];
+
+            if (FixedSteps[i] > 0.0f || LODStates[i].IsActive())
+            {
+                Velocities[i] = GetTangentVelocity(Angles[i], AngularVelocities[i], HangLengths[i]);
+            }
+            else if (DeltaTime > KINDA_SMALL_NUMBER)
+            {
+                Velocities[i] = (NewPos - Positions[i]) / DeltaTime;
+            }
+            Positions[i] = NewPos;
+        }
+    }, NumBatches > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+}
+
+void USwingSimulationSubsystem::Commit()
+{
+    // Walk backwards so a swinger released from gameplay code during its
+    // commit (overlap events etc.) doesn't shift anyone we haven't visited
+    for (int32 i = Swingers.Num() - 1; i >= 0; --i)
+    {
+        if (!Swingers.IsValidIndex(i) || CommitDeltaTimes[i] < 0.0f) continue;
+
+        Swingers[i]->CommitSimulatedSwing(
+            Angles[i], AngularVelocities[i], PrevAngles[i], Accumulators[i],
+            Positions[i], Velocities[i], CommitDeltaTimes[i]);
+    }
+}
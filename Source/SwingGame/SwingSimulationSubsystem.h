@@ -0,0 +1,116 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SwingPendulumEnvelope.h"
+#include "SwingSimulationSubsystem.generated.h"
+
+class USwingComponent;
+
+/**
+ * Steps the pendulum of every swinging USwingComponent in one batch.
+ * Pendulum state lives here as structure-of-arrays while a character swings;
+ * the integration pass runs FSwingPendulumKernel::StepBatch over runs of
+ * BatchSize swingers (split across workers when there are several runs), then
+ * transforms are committed on the game thread in a single pass. Swinging
+ * components stop ticking on their own.
+ */
+UCLASS()
+class SWINGGAME_API USwingSimulationSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** Starts simulating Swinger from its current pendulum state */
+    void AddSwinger(USwingComponent* Swinger);
+
+    /** Stops simulating Swinger — its component fields keep the last committed state */
+    void RemoveSwinger(USwingComponent* Swinger);
+
+    /** Overwrites Swinger's pendulum — server corrections of a replicated swing */
+    void SetSwingerState(USwingComponent* Swinger, float Angle, float AngularVelocity);
+
+    int32 GetNumSwingers() const { return Swingers.Num(); }
+
+    /**
+     * Advances one pendulum by DeltaTime: gravity, auto-pump, damping and angle clamp
+     * to [MinAngle, MaxAngle], bouncing off a limit with a non-zero restitution (obstacles).
+     * Shared by the batched pass and USwingComponent's own tick.
+     */
+    static void StepPendulum(
+        float& Angle, float& AngularVelocity,
+        float HangLength, float AutoSwingForce, float Damping, float MinAngle, float MaxAngle,
+        float DeltaTime, float MinRestitution = 0.0f, float MaxRestitution = 0.0f);
+
+    /**
+     * Advances one pendulum by a frame of DeltaTime.
+     * With FixedStep > 0 the frame is consumed in whole fixed steps from Accumulator
+     * (at most MaxSubsteps — surplus time from a hitch is dropped) and the returned
+     * render angle is interpolated between the last two steps. Otherwise it steps
+     * once with DeltaTime and returns the new angle.
+     */
+    static float AdvancePendulum(
+        float& Angle, float& AngularVelocity, float& PrevAngle, float& Accumulator,
+        float HangLength, float AutoSwingForce, float Damping, float MinAngle, float MaxAngle,
+        float FixedStep, int32 MaxSubsteps, float DeltaTime,
+        float MinRestitution = 0.0f, float MaxRestitution = 0.0f);
+
+    /** Velocity of the hang point along the arc for the given pendulum state */
+    static FVector GetTangentVelocity(float Angle, float AngularVelocity, float HangLength);
+
+    /**
+     * Adds DeltaTime to Accumulator and takes out the whole fixed steps to run now,
+     * at most MaxSubsteps — surplus time from a hitch is dropped.
+     */
+    static int32 ConsumeFixedSteps(float& Accumulator, float FixedStep, int32 MaxSubsteps, float DeltaTime);
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    void UpdateSignificance(float DeltaTime);
+    void Simulate(float DeltaTime);
+    void Commit();
+    void ExitLOD(int32 Index);
+    void RemoveAtSwap(int32 Index);
+
+    /** Swingers per worker task — below this everything runs on the game thread */
+    static constexpr int32 BatchSize = 64;
+
+    UPROPERTY()
+    TArray<TObjectPtr<USwingComponent>> Swingers;
+
+    TArray<float>   Angles;
+    TArray<float>   AngularVelocities;
+    TArray<float>   HangLengths;
+    TArray<float>   AutoSwingForces;
+    TArray<float>   Dampings;
+    TArray<float>   DampingLog2s;
+    TArray<float>   MinAngles;
+    TArray<float>   MaxAngles;
+    TArray<float>   MinRestitutions;
+    TArray<float>   MaxRestitutions;
+    TArray<FVector> Pivots;
+
+    /** Fixed-step mode — FixedSteps is 0 for swingers stepping on frame time */
+    TArray<float>   FixedSteps;
+    TArray<int32>   SubstepLimits;
+    TArray<float>   Accumulators;
+    TArray<float>   PrevAngles;
+
+    /** Last committed position, used to derive the per-frame release velocity */
+    TArray<FVector> Positions;
+    TArray<FVector> Velocities;
+
+    /** Swing LOD — LODIntervals is 0 for swingers that never drop to LOD */
+    TArray<FSwingLODState> LODStates;
+    TArray<float>          LODIntervals;
+    TArray<float>          LODPendingTimes;
+    TArray<float>          SignificanceTimers;
+
+    /** Time covered by this frame's transform commit — negative when unchanged (LOD) */
+    TArray<float> CommitDeltaTimes;
+};
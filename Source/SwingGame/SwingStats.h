@@ -0,0 +1,19 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Running totals of the engine work swing code asks for, read by the swing
+ * benchmark. Only touched on the game thread.
+ */
+struct FSwingStats
+{
+    /** Sweeps and traces issued by swing code */
+    inline static int64 SceneQueries = 0;
+
+    /** Actor / component transform changes issued by swing code */
+    inline static int64 TransformUpdates = 0;
+
+    /** Server corrections of a locally predicted swing */
+    inline static int64 NetCorrections = 0;
+};
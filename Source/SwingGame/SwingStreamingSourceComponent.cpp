@@ -0,0 +1,187 @@
+#include "SwingStreamingSourceComponent.h"
+#include "SwingComponent.h"
+#include "SwingLaunchPrediction.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Engine/World.h"
+#include "WorldPartition/WorldPartition.h"
+#include "WorldPartition/WorldPartitionSubsystem.h"
+
+USwingStreamingSourceComponent::USwingStreamingSourceComponent()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.TickGroup    = TG_PostPhysics;
+}
+
+void USwingStreamingSourceComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    SwingComponent = GetOwner()->FindComponentByClass<USwingComponent>();
+    SetComponentTickInterval(PredictionInterval);
+
+    for (int32 Slot = 0; Slot < UE_ARRAY_COUNT(SourceNames); ++Slot)
+        SourceNames[Slot] = FName(*FString::Printf(TEXT("%s_SwingLanding%d"), *GetOwner()->GetName(), Slot));
+
+    if (UWorldPartitionSubsystem* WorldPartition = GetWorld()->GetSubsystem<UWorldPartitionSubsystem>())
+    {
+        WorldPartition->RegisterStreamingSourceProvider(this);
+        bRegistered = true;
+    }
+}
+
+void USwingStreamingSourceComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (bRegistered)
+    {
+        if (UWorldPartitionSubsystem* WorldPartition = GetWorld()->GetSubsystem<UWorldPartitionSubsystem>())
+            WorldPartition->UnregisterStreamingSourceProvider(this);
+        bRegistered = false;
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void USwingStreamingSourceComponent::TickComponent(
+    float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    UpdatePredictions();
+}
+
+bool USwingStreamingSourceComponent::IsPlayerSource() const
+{
+    const APawn* Pawn = Cast<APawn>(GetOwner());
+    if (!Pawn || !Pawn->IsPlayerControlled()) return false;
+
+    // Remote players' proxies are player controlled too — a client streams for its own pawn only
+    if (Pawn->IsLocallyControlled()) return true;
+    if (GetNetMode() == NM_Client) return false;
+
+    // Server: remote players' pawns only when the server streams for them
+    const UWorldPartition* WorldPartition = GetWorld()->GetWorldPartition();
+    return WorldPartition && WorldPartition->IsServerStreamingEnabled();
+}
+
+// ---------------------------------------------------------------------------
+// Prediction
+// ---------------------------------------------------------------------------
+
+void USwingStreamingSourceComponent::UpdatePredictions()
+{
+    Landings.Reset();
+
+    const ACharacter* Character = Cast<ACharacter>(GetOwner());
+    const UCharacterMovementComponent* CMC = Character ? Character->GetCharacterMovement() : nullptr;
+    if (!bPredictLanding || !CMC || !IsPlayerSource()) return;
+
+    if (CMC->IsMovingOnGround())
+    {
+        LandingZ     = Character->GetActorLocation().Z;
+        bHasLandingZ = true;
+        return;
+    }
+    if (!bHasLandingZ) return;
+
+    const float Gravity = -GetWorld()->GetGravityZ();
+    if (Gravity <= KINDA_SMALL_NUMBER) return;
+
+    if (SwingComponent && SwingComponent->SwingState == ESwingState::Swinging)
+        PredictSwingLandings(Gravity);
+    else if (CMC->IsFalling())
+        PredictFlightLanding(Gravity);
+}
+
+void USwingStreamingSourceComponent::PredictSwingLandings(float Gravity)
+{
+    const float L                 = FMath::Max(SwingComponent->GetHangLength(), 1.0f);
+    const float GravityOverLength = Gravity / L;
+    const float Angle             = SwingComponent->SwingAngle;
+    const float AngularVelocity   = SwingComponent->SwingAngularVelocity;
+
+    // Amplitude of the current energy: ½ω² + (g/L)(1 - cos θ) = (g/L)(1 - cos A)
+    const float CosAmplitude = FMath::Cos(Angle) - AngularVelocity * AngularVelocity / (2.0f * GravityOverLength);
+    const float Amplitude    = FMath::Min(
+        CosAmplitude <= -1.0f ? UE_PI : FMath::Acos(FMath::Min(CosAmplitude, 1.0f)),
+        SwingComponent->MaxSwingAngle);
+    const float CosClamped   = FMath::Cos(Amplitude);
+
+    const int32 NumSamples = FMath::Max(ReleaseSamples, 2);
+
+    // Farthest landing of a release in each swing direction
+    for (const float Direction : { 1.0f, -1.0f })
+    {
+        FPredictedLanding Best;
+        float BestDistSq = -1.0f;
+
+        for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+        {
+            const float ReleaseAngle    = FMath::Lerp(-Amplitude, Amplitude, float(Sample) / float(NumSamples - 1));
+            const float ReleaseVelocity = Direction * FMath::Sqrt(
+                FMath::Max(2.0f * GravityOverLength * (FMath::Cos(ReleaseAngle) - CosClamped), 0.0f));
+
+            const FSwingLaunchPrediction Prediction = FSwingLaunchPrediction::Predict(
+                SwingComponent->PivotWorldLocation, L, ReleaseAngle, ReleaseVelocity,
+                SwingComponent->LaunchSpeedMultiplier, Gravity, LandingZ);
+            if (!Prediction.bValid) continue;
+
+            const float DistSq = FVector::DistSquared2D(Prediction.LaunchLocation, Prediction.LandingLocation);
+            if (DistSq > BestDistSq)
+            {
+                BestDistSq    = DistSq;
+                Best.Location = Prediction.LandingLocation;
+                Best.Speed    = Prediction.LaunchVelocity.Size();
+            }
+        }
+
+        if (BestDistSq >= 0.0f) Landings.Add(Best);
+    }
+}
+
+void USwingStreamingSourceComponent::PredictFlightLanding(float Gravity)
+{
+    // Release zeroes air braking, so the flight is the exact parabola
+    const FVector Location = GetOwner()->GetActorLocation();
+    const FVector Velocity = GetOwner()->GetVelocity();
+
+    const float Disc = Velocity.Z * Velocity.Z + 2.0f * Gravity * (Location.Z - LandingZ);
+    if (Disc < 0.0f) return;
+
+    const float Time = (Velocity.Z + FMath::Sqrt(Disc)) / Gravity;
+
+    FPredictedLanding& Landing = Landings.AddDefaulted_GetRef();
+    Landing.Location  = FVector(Location.X + Velocity.X * Time, Location.Y + Velocity.Y * Time, LandingZ);
+    Landing.Speed     = Velocity.Size();
+    Landing.bInFlight = true;
+}
+
+// ---------------------------------------------------------------------------
+// IWorldPartitionStreamingSourceProvider
+// ---------------------------------------------------------------------------
+
+bool USwingStreamingSourceComponent::GetStreamingSources(TArray<FWorldPartitionStreamingSource>& OutStreamingSources) const
+{
+    if (Landings.IsEmpty() || !IsPlayerSource()) return false;
+
+    for (int32 Slot = 0; Slot < Landings.Num(); ++Slot)
+    {
+        const FPredictedLanding& Landing = Landings[Slot];
+
+        FWorldPartitionStreamingSource& Source = OutStreamingSources.AddDefaulted_GetRef();
+        Source.Name        = SourceNames[Slot];
+        Source.Location    = Landing.Location;
+        Source.Rotation    = FRotator::ZeroRotator;
+        Source.TargetState = EStreamingSourceTargetState::Activated;
+        Source.Priority    = Landing.bInFlight ? FlightPriority : SwingPriority;
+        Source.Velocity    = Landing.Speed;
+
+        if (LandingRadius > 0.0f)
+        {
+            FStreamingSourceShape& Shape = Source.Shapes.AddDefaulted_GetRef();
+            Shape.bUseGridLoadingRange = false;
+            Shape.Radius               = LandingRadius;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "WorldPartition/WorldPartitionStreamingSource.h"
+#include "SwingStreamingSourceComponent.generated.h"
+
+class USwingComponent;
+
+/**
+ * World Partition streaming sources at the predicted landing points of a swinger.
+ *
+ * While swinging, releases across the current arc (in both swing directions) are
+ * run through FSwingLaunchPrediction and the farthest landing each way becomes a
+ * source, so cells are requested before the player lets go. In flight the exact
+ * parabola's landing replaces them. Landings are taken on the height of the last
+ * walkable floor. Only locally controlled players provide sources, plus remote
+ * players on a server that streams for them (World Partition server streaming).
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class SWINGGAME_API USwingStreamingSourceComponent : public UActorComponent, public IWorldPartitionStreamingSourceProvider
+{
+    GENERATED_BODY()
+
+public:
+    USwingStreamingSourceComponent();
+
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void TickComponent(
+        float DeltaTime,
+        ELevelTick TickType,
+        FActorComponentTickFunction* ThisTickFunction) override;
+
+    // IWorldPartitionStreamingSourceProvider
+    virtual bool GetStreamingSources(TArray<FWorldPartitionStreamingSource>& OutStreamingSources) const override;
+    virtual const UObject* GetStreamingSourceOwner() const override { return this; }
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming")
+    bool bPredictLanding = true;
+
+    /** Seconds between trajectory predictions */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming", meta = (ClampMin = 0.02))
+    float PredictionInterval = 0.1f;
+
+    /** Release angles tried across the current arc, per swing direction */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming", meta = (ClampMin = 2))
+    int32 ReleaseSamples = 8;
+
+    /** Loading radius around each landing, 0 uses the grid's loading range (cm) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming", meta = (ClampMin = 0))
+    float LandingRadius = 0.0f;
+
+    /** Priority of the landing of the flight in progress */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming")
+    EStreamingSourcePriority FlightPriority = EStreamingSourcePriority::Highest;
+
+    /** Priority of the landings of possible releases */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming")
+    EStreamingSourcePriority SwingPriority = EStreamingSourcePriority::High;
+
+private:
+    struct FPredictedLanding
+    {
+        FVector Location  = FVector::ZeroVector;
+        float   Speed     = 0.0f;
+        bool    bInFlight = false;
+    };
+
+    void UpdatePredictions();
+    void PredictSwingLandings(float Gravity);
+    void PredictFlightLanding(float Gravity);
+    bool IsPlayerSource() const;
+
+    UPROPERTY()
+    TObjectPtr<USwingComponent> SwingComponent;
+
+    TArray<FPredictedLanding, TInlineAllocator<2>> Landings;
+
+    /** Source names, unique per owner — one per landing slot */
+    FName SourceNames[2];
+
+    /** Actor height while last standing on a walkable floor — predictions land there */
+    float LandingZ     = 0.0f;
+    bool  bHasLandingZ = false;
+
+    bool bRegistered = false;
+};
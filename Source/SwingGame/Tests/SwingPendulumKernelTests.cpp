@@ -0,0 +1,308 @@
+#include "SwingPendulumKernel.h"
+#include "SwingPoleGraph.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    /** Default USwingComponent tuning */
+    constexpr float TestHangLength     = 120.0f;
+    constexpr float TestAutoSwingForce = 3.7f;
+    constexpr float TestDamping        = 0.988f;
+    constexpr float TestDeltaTime      = 1.0f / 60.0f;
+    constexpr float TestMaxSwingAngle  = 2.2f;
+
+    /** FSwingPendulumKernel::Step as it was before obstacle rebounds — the clamp only limits the angle */
+    void StepWithoutRebound(float& Angle, float& AngularVelocity, float HangLength, float DeltaTime)
+    {
+        const float Alpha = -(FSwingPendulumKernel::Gravity / HangLength) * std::sin(Angle);
+        AngularVelocity += Alpha * DeltaTime;
+
+        const float Dir = std::fabs(AngularVelocity) > FSwingPendulumKernel::PumpThreshold
+            ? FSwingPendulumKernel::Sign(AngularVelocity)
+            : FSwingPendulumKernel::Sign(Angle);
+        AngularVelocity += Dir * TestAutoSwingForce * DeltaTime;
+
+        AngularVelocity *= std::pow(TestDamping, DeltaTime * 60.0f);
+
+        Angle = std::min(std::max(Angle + AngularVelocity * DeltaTime, -TestMaxSwingAngle), TestMaxSwingAngle);
+    }
+
+    /** Energy per unit m·L²: ½ω² + (g/L)(1 - cos θ) */
+    float GetEnergy(float Angle, float AngularVelocity, float HangLength)
+    {
+        return 0.5f * AngularVelocity * AngularVelocity
+            + (FSwingPendulumKernel::Gravity / HangLength) * (1.0f - FMath::Cos(Angle));
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSwingPendulumClampReboundTest, "SwingGame.Pendulum.ClampRebound",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSwingPendulumClampReboundTest::RunTest(const FString& Parameters)
+{
+    // Obstacle at +1 rad, well inside the reach of a swing started at 4 rad/s; the far side is open
+    constexpr float MinAngle = -TestMaxSwingAngle;
+    constexpr float MaxAngle = 1.0f;
+
+    float Angle           = 0.0f;
+    float AngularVelocity = 4.0f;
+    int32 ContactSteps    = 0;
+    bool  bLeftLimit      = false;
+
+    for (int32 Step = 0; Step < 600; ++Step)
+    {
+        FSwingPendulumKernel::Step(
+            Angle, AngularVelocity,
+            TestHangLength, TestAutoSwingForce, TestDamping, MinAngle, MaxAngle, TestDeltaTime,
+            0.0f, FSwingPendulumKernel::ClampRestitution);
+
+        if (Angle >= MaxAngle)
+        {
+            ++ContactSteps;
+            if (AngularVelocity > 0.0f)
+            {
+                AddError(FString::Printf(TEXT("Step %d: angular velocity %.3f points into the limit"), Step, AngularVelocity));
+                return false;
+            }
+        }
+        else if (ContactSteps > 0 && Angle < MaxAngle - 0.25f)
+        {
+            bLeftLimit = true;
+        }
+    }
+
+    TestTrue(TEXT("Swing reaches the limit"), ContactSteps > 0);
+    TestTrue(TEXT("Swing comes back off the limit"), bLeftLimit);
+    TestTrue(TEXT("Swing does not rest at the limit"), ContactSteps < 60);
+
+    // Unobstructed swings keep pinning at ±MaxSwingAngle exactly as before, short and long hangs alike
+    for (const float HangLength : { TestHangLength, 300.0f })
+    {
+        float ReboundAngle = 0.3f, ReboundAngularVelocity = 0.0f;
+        float PinnedAngle  = 0.3f, PinnedAngularVelocity  = 0.0f;
+        int32 PinnedSteps  = 0;
+
+        for (int32 Step = 0; Step < 1800; ++Step)
+        {
+            FSwingPendulumKernel::Step(
+                ReboundAngle, ReboundAngularVelocity,
+                HangLength, TestAutoSwingForce, TestDamping, -TestMaxSwingAngle, TestMaxSwingAngle, TestDeltaTime);
+            StepWithoutRebound(PinnedAngle, PinnedAngularVelocity, HangLength, TestDeltaTime);
+
+            if (FMath::Abs(PinnedAngle) >= TestMaxSwingAngle) ++PinnedSteps;
+        }
+
+        const FString Hang = FString::Printf(TEXT("Open arc, hang %.0f"), HangLength);
+        TestEqual(Hang + TEXT(": angle unchanged"), ReboundAngle, PinnedAngle);
+        TestEqual(Hang + TEXT(": angular velocity unchanged"), ReboundAngularVelocity, PinnedAngularVelocity);
+        if (HangLength == TestHangLength)
+            TestTrue(Hang + TEXT(": default swing reaches the open limit"), PinnedSteps > 0);
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSwingPendulumBatchMatchesStepTest, "SwingGame.Pendulum.BatchMatchesStep",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSwingPendulumBatchMatchesStepTest::RunTest(const FString& Parameters)
+{
+    // Polynomial sin / exp2 stay within ~1e-6 per step; allow for 10 s of accumulation
+    constexpr float AngleTolerance           = 1.0e-4f;
+    constexpr float AngularVelocityTolerance = 1.0e-3f;
+
+    // Not a multiple of any lane width, so the scalar tail runs too
+    constexpr int32 Count    = 67;
+    constexpr int32 NumSteps = 600;
+
+    TArray<float> Angles, AngularVelocities, HangLengths, AutoSwingForces, DampingLog2s, MinAngles, MaxAngles;
+    TArray<float> MinRestitutions, MaxRestitutions, DeltaTimes;
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const float Phase = float(Index) / float(Count - 1);
+        Angles.Add(FMath::Lerp(-2.0f, 2.0f, Phase));
+        AngularVelocities.Add(FMath::Lerp(3.0f, -3.0f, Phase));
+        HangLengths.Add(FMath::Lerp(100.0f, 250.0f, Phase));
+        AutoSwingForces.Add(TestAutoSwingForce);
+        DampingLog2s.Add(FSwingPendulumKernel::GetDampingLog2(TestDamping));
+        MinAngles.Add(-2.2f);
+        MaxAngles.Add(Index % 5 == 0 ? 1.0f : 2.2f);
+
+        // Obstacle limits rebound, open ones pin
+        MinRestitutions.Add(0.0f);
+        MaxRestitutions.Add(Index % 5 == 0 ? FSwingPendulumKernel::ClampRestitution : 0.0f);
+
+        // Frame-time and fixed-step lanes side by side, plus lanes sitting the step out
+        DeltaTimes.Add(Index % 7 == 0 ? 0.0f : (Index % 2 == 0 ? TestDeltaTime : 1.0f / 120.0f));
+    }
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        Angles[Index] = FMath::Clamp(Angles[Index], MinAngles[Index], MaxAngles[Index]);
+    }
+
+    TArray<float> StepAngles = Angles, StepAngularVelocities = AngularVelocities;
+    TArray<float> ScalarAngles = Angles, ScalarAngularVelocities = AngularVelocities;
+
+    for (int32 Step = 0; Step < NumSteps; ++Step)
+    {
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            FSwingPendulumKernel::Step(
+                StepAngles[Index], StepAngularVelocities[Index],
+                HangLengths[Index], AutoSwingForces[Index], TestDamping, MinAngles[Index], MaxAngles[Index],
+                DeltaTimes[Index], MinRestitutions[Index], MaxRestitutions[Index]);
+        }
+
+        FSwingPendulumKernel::StepBatch(
+            Angles.GetData(), AngularVelocities.GetData(),
+            HangLengths.GetData(), AutoSwingForces.GetData(), DampingLog2s.GetData(),
+            MinAngles.GetData(), MaxAngles.GetData(),
+            MinRestitutions.GetData(), MaxRestitutions.GetData(), DeltaTimes.GetData(), Count);
+
+        FSwingPendulumKernel::StepBatchScalar(
+            ScalarAngles.GetData(), ScalarAngularVelocities.GetData(),
+            HangLengths.GetData(), AutoSwingForces.GetData(), DampingLog2s.GetData(),
+            MinAngles.GetData(), MaxAngles.GetData(),
+            MinRestitutions.GetData(), MaxRestitutions.GetData(), DeltaTimes.GetData(), Count);
+    }
+
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const FString Lane = FString::Printf(TEXT("Pendulum %d (%hs)"), Index, FSwingPendulumKernel::GetBatchPathName());
+
+        TestNearlyEqual(Lane + TEXT(" angle vs Step"), Angles[Index], StepAngles[Index], AngleTolerance);
+        TestNearlyEqual(Lane + TEXT(" angular velocity vs Step"),
+            AngularVelocities[Index], StepAngularVelocities[Index], AngularVelocityTolerance);
+
+        // Same polynomials lane by lane — only instruction-level rounding may differ
+        TestNearlyEqual(Lane + TEXT(" angle vs StepBatchScalar"), Angles[Index], ScalarAngles[Index], 1.0e-5f);
+        TestNearlyEqual(Lane + TEXT(" angular velocity vs StepBatchScalar"),
+            AngularVelocities[Index], ScalarAngularVelocities[Index], 1.0e-5f);
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSwingPendulumDampingLosesEnergyTest, "SwingGame.Pendulum.DampingLosesEnergy",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSwingPendulumDampingLosesEnergyTest::RunTest(const FString& Parameters)
+{
+    // Symplectic Euler trades energy between steps near the turning points, where damping
+    // takes almost nothing — so compare swing to swing: every turning point sits lower.
+    for (const float DeltaTime : { 1.0f / 30.0f, TestDeltaTime, 1.0f / 240.0f })
+    {
+        float Angle           = 1.0f;
+        float AngularVelocity = 0.0f;
+        float LastPeakEnergy  = GetEnergy(Angle, AngularVelocity, TestHangLength);
+        int32 NumPeaks        = 0;
+
+        const int32 NumSteps = FMath::RoundToInt(10.0f / DeltaTime);
+        for (int32 Step = 0; Step < NumSteps; ++Step)
+        {
+            const float PreviousAngularVelocity = AngularVelocity;
+            FSwingPendulumKernel::Step(
+                Angle, AngularVelocity,
+                TestHangLength, 0.0f, TestDamping, -TestMaxSwingAngle, TestMaxSwingAngle, DeltaTime);
+
+            if (Step == 0 || (AngularVelocity > 0.0f) == (PreviousAngularVelocity > 0.0f)) continue;
+
+            const float Energy = GetEnergy(Angle, AngularVelocity, TestHangLength);
+            if (Energy >= LastPeakEnergy)
+            {
+                AddError(FString::Printf(TEXT("%.0f fps, step %d: energy %.5f did not drop from %.5f"),
+                    1.0f / DeltaTime, Step, Energy, LastPeakEnergy));
+                return false;
+            }
+            LastPeakEnergy = Energy;
+            ++NumPeaks;
+        }
+
+        TestTrue(FString::Printf(TEXT("%.0f fps swings back and forth"), 1.0f / DeltaTime), NumPeaks > 5);
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSwingPendulumConservesEnergyTest, "SwingGame.Pendulum.ConservesEnergy",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSwingPendulumConservesEnergyTest::RunTest(const FString& Parameters)
+{
+    // Symplectic Euler keeps the energy error bounded at O(ω·dt) instead of drifting; ~2.3% at 60 Hz
+    constexpr float Tolerance = 0.03f;
+    constexpr int32 NumSteps  = 3600;
+
+    for (const float StartAngle : { 0.3f, 1.0f, 2.0f })
+    {
+        float Angle           = StartAngle;
+        float AngularVelocity = 0.0f;
+        const float StartEnergy = GetEnergy(Angle, AngularVelocity, TestHangLength);
+        float MaxError          = 0.0f;
+
+        for (int32 Step = 0; Step < NumSteps; ++Step)
+        {
+            FSwingPendulumKernel::Step(
+                Angle, AngularVelocity,
+                TestHangLength, 0.0f, 1.0f, -UE_PI, UE_PI, TestDeltaTime);
+
+            const float Error = FMath::Abs(GetEnergy(Angle, AngularVelocity, TestHangLength) - StartEnergy) / StartEnergy;
+            MaxError = FMath::Max(MaxError, Error);
+        }
+
+        TestTrue(FString::Printf(TEXT("Start %.1f rad: energy within %.0f%% over 60 s (worst %.2f%%)"),
+            StartAngle, Tolerance * 100.0f, MaxError * 100.0f), MaxError <= Tolerance);
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSwingPendulumSteadyAmplitudeTest, "SwingGame.Pendulum.SteadyAmplitude",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSwingPendulumSteadyAmplitudeTest::RunTest(const FString& Parameters)
+{
+    // The cycle-averaged balance assumes a square-wave pump; it reads a few percent low at larger amplitudes
+    constexpr float Tolerance = 0.05f;
+
+    struct FCase { float HangLength; float AutoSwingForce; };
+    const FCase Cases[] =
+    {
+        { TestHangLength, 1.0f },
+        { 300.0f,         1.0f },
+        { TestHangLength, TestAutoSwingForce }, // Default tuning settles at MaxSwingAngle
+    };
+
+    for (const FCase& Case : Cases)
+    {
+        FSwingReachTuning Tuning;
+        Tuning.AutoSwingForce = Case.AutoSwingForce;
+        Tuning.SwingDamping   = TestDamping;
+        Tuning.MaxSwingAngle  = TestMaxSwingAngle;
+        const float SteadyAmplitude = Tuning.GetSteadyAmplitude(Case.HangLength);
+
+        for (const float DeltaTime : { 1.0f / 30.0f, 1.0f / 240.0f })
+        {
+            // Start in motion, as a grab does; the peak of the last 5 of 60 s is the settled amplitude
+            float Angle           = 0.0f;
+            float AngularVelocity = 2.0f;
+            float Amplitude       = 0.0f;
+
+            const int32 NumSteps    = FMath::RoundToInt(60.0f / DeltaTime);
+            const int32 SettledStep = NumSteps - FMath::RoundToInt(5.0f / DeltaTime);
+            for (int32 Step = 0; Step < NumSteps; ++Step)
+            {
+                FSwingPendulumKernel::Step(
+                    Angle, AngularVelocity,
+                    Case.HangLength, Case.AutoSwingForce, TestDamping, -TestMaxSwingAngle, TestMaxSwingAngle, DeltaTime);
+
+                if (Step >= SettledStep) Amplitude = FMath::Max(Amplitude, FMath::Abs(Angle));
+            }
+
+            TestNearlyEqual(
+                FString::Printf(TEXT("Hang %.0f, force %.1f at %.0f fps"), Case.HangLength, Case.AutoSwingForce, 1.0f / DeltaTime),
+                Amplitude, SteadyAmplitude, SteadyAmplitude * Tolerance);
+        }
+    }
+    return true;
+}
+
+#endif
@@ -17,3 +17,18 @@ ACombatAIController::ACombatAIController()
 	// this is necessary for EnvQueries to work correctly
 	bAttachToPawn = true;
 }
+
+void ACombatAIController::SuspendLogic()
+{
+	// stop any path following
+	StopMovement();
+
+	// stop StateTree so the pooled enemy doesn't think
+	StateTreeAI->StopLogic(TEXT("Pooled"));
+}
+
+void ACombatAIController::ResumeLogic()
+{
+	// start StateTree fresh, as if we had just possessed the enemy
+	StateTreeAI->RestartLogic();
+}
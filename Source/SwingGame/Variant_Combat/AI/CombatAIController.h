@@ -24,4 +24,10 @@ public:
 
 	/** Constructor */
 	ACombatAIController();
+
+	/** Stops StateTree and any movement while the possessed enemy waits in a pool */
+	void SuspendLogic();
+
+	/** Restarts StateTree from its root state when the possessed enemy leaves the pool */
+	void ResumeLogic();
 };
@@ -11,6 +11,8 @@
 #include "TimerManager.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Animation/AnimInstance.h"
+#include "CombatHitSubsystem.h"
+#include "CombatSpatialSubsystem.h"
 
 ACombatEnemy::ACombatEnemy()
 {
@@ -123,50 +125,53 @@ float ACombatEnemy::GetLastDangerTime() const
 	return LastDangerTime;
 }
 
+FCombatAttackTrace ACombatEnemy::MakeAttackTrace()
+{
+	FCombatAttackTrace Trace;
+	Trace.Attacker = this;
+
+	// use a sphere shape for the sweep
+	Trace.Radius = MeleeTraceRadius;
+
+	// enemies only affect Pawn collision objects; they don't knock back boxes
+	Trace.ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
+
+	// enemies only damage actors with the player tag
+	Trace.RequiredTag = FName("Player");
+
+	Trace.Damage = MeleeDamage;
+	Trace.KnockbackImpulse = MeleeKnockbackImpulse;
+	Trace.LaunchImpulse = MeleeLaunchImpulse;
+
+	return Trace;
+}
+
 void ACombatEnemy::DoAttackTrace(FName DamageSourceBone)
 {
 	// sweep for objects in front of the character to be hit by the attack
-	TArray<FHitResult> OutHits;
+	FCombatAttackTrace Trace = MakeAttackTrace();
 
 	// start at the provided socket location, sweep forward
-	const FVector TraceStart = GetMesh()->GetSocketLocation(DamageSourceBone);
-	const FVector TraceEnd = TraceStart + (GetActorForwardVector() * MeleeTraceDistance);
+	Trace.Start = GetMesh()->GetSocketLocation(DamageSourceBone);
+	Trace.End = Trace.Start + (GetActorForwardVector() * MeleeTraceDistance);
 
-	// enemies only affect Pawn collision objects; they don't knock back boxes
-	FCollisionObjectQueryParams ObjectParams;
-	ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
+	// the hit subsystem sweeps along with the rest of the frame's attacks and applies the damage
+	UCombatHitSubsystem::QueueAttackTrace(GetWorld(), MoveTemp(Trace));
+}
 
-	// use a sphere shape for the sweep
-	FCollisionShape CollisionShape;
-	CollisionShape.SetSphere(MeleeTraceRadius);
+void ACombatEnemy::BeginAttackSweep(FName DamageSourceBone, const UAnimMontage* Montage)
+{
+	AttackSweep.Begin(GetMesh(), Montage, DamageSourceBone, AttackTrajectory);
+}
 
-	// ignore self
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(this);
+void ACombatEnemy::UpdateAttackSweep()
+{
+	AttackSweep.Update(GetMesh(), MakeAttackTrace());
+}
 
-	if (GetWorld()->SweepMultiByObjectType(OutHits, TraceStart, TraceEnd, FQuat::Identity, ObjectParams, CollisionShape, QueryParams))
-	{
-		// iterate over each object hit
-		for (const FHitResult& CurrentHit : OutHits)
-		{
-			/** does the actor have the player tag? */
-			if (CurrentHit.GetActor()->ActorHasTag(FName("Player")))
-			{
-				// check if the actor is damageable
-				ICombatDamageable* Damageable = Cast<ICombatDamageable>(CurrentHit.GetActor());
-
-				if (Damageable)
-				{
-					// knock upwards and away from the impact normal
-					const FVector Impulse = (CurrentHit.ImpactNormal * -MeleeKnockbackImpulse) + (FVector::UpVector * MeleeLaunchImpulse);
-
-					// pass the damage event to the actor
-					Damageable->ApplyDamage(MeleeDamage, this, CurrentHit.ImpactPoint, Impulse);
-
-				}
-			}
-		}
-	}
+void ACombatEnemy::EndAttackSweep()
+{
+	AttackSweep.End();
 }
 
 void ACombatEnemy::CheckCombo()
@@ -231,6 +236,9 @@ void ACombatEnemy::ApplyDamage(float Damage, AActor* DamageCauser, const FVector
 
 void ACombatEnemy::HandleDeath()
 {
+	// stop any attack in progress
+	AttackSweep.End();
+
 	// hide the life bar
 	LifeBar->SetHiddenInGame(true);
 
@@ -268,10 +276,119 @@ void ACombatEnemy::NotifyDanger(const FVector& DangerLocation, AActor* DangerSou
 
 void ACombatEnemy::RemoveFromLevel()
 {
+	// are we owned by a pool?
+	if (OnEnemyReturnedToPool.IsBound())
+	{
+		// deactivate and hand ourselves back so we can be reused
+		DeactivateToPool();
+		OnEnemyReturnedToPool.Execute(this);
+		return;
+	}
+
 	// destroy this actor
 	Destroy();
 }
 
+void ACombatEnemy::DeactivateToPool()
+{
+	// raise the pooled flag
+	bIsInPool = true;
+
+	// clear the death timer in case we're pooled early
+	GetWorld()->GetTimerManager().ClearTimer(DeathTimer);
+
+	// stop any attack in progress
+	AttackSweep.End();
+
+	// stop StateTree before the montages so no task reacts to the interruption
+	if (ACombatAIController* AIController = Cast<ACombatAIController>(GetController()))
+	{
+		AIController->SuspendLogic();
+	}
+
+	if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
+	{
+		AnimInstance->StopAllMontages(0.0f);
+	}
+
+	// leave ragdoll and put the mesh back in place under the capsule
+	GetMesh()->SetSimulatePhysics(false);
+	GetMesh()->SetPhysicsBlendWeight(0.0f);
+	GetMesh()->AttachToComponent(GetCapsuleComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+	GetMesh()->SetRelativeTransform(MeshRelativeTransform);
+
+	// stop moving
+	GetCharacterMovement()->StopMovementImmediately();
+	GetCharacterMovement()->DisableMovement();
+
+	// pooled enemies can't be found by spatial queries
+	if (UCombatSpatialSubsystem* SpatialSubsystem = GetWorld()->GetSubsystem<UCombatSpatialSubsystem>())
+	{
+		SpatialSubsystem->UnregisterPawn(this);
+	}
+
+	// hide the enemy and take it out of collision and ticking
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetActorTickEnabled(false);
+	GetMesh()->SetComponentTickEnabled(false);
+}
+
+void ACombatEnemy::ActivateFromPool(const FTransform& SpawnTransform)
+{
+	// lower the pooled flag
+	bIsInPool = false;
+
+	// reset HP to maximum before StateTree restarts so it picks it up at the right value
+	CurrentHP = MaxHP;
+
+	// reset the attack and danger state
+	bIsAttacking = false;
+	CurrentComboAttack = 0;
+	CurrentChargeLoop = 0;
+	LastDangerLocation = FVector::ZeroVector;
+	LastDangerTime = -1000.0f;
+
+	// restore collision before moving so we get nudged out of anything blocking the spawn point
+	SetActorEnableCollision(true);
+	GetCapsuleComponent()->SetCollisionEnabled(CapsuleCollision);
+
+	if (!TeleportTo(SpawnTransform.GetLocation(), SpawnTransform.Rotator()))
+	{
+		// always spawn, even if the spawn point is blocked
+		SetActorLocationAndRotation(SpawnTransform.GetLocation(), SpawnTransform.GetRotation(), false, nullptr, ETeleportType::ResetPhysics);
+	}
+
+	// enable character movement
+	GetCharacterMovement()->SetDefaultMovementMode();
+
+	// show and fill the life bar
+	LifeBar->SetHiddenInGame(false);
+	LifeBarWidget->SetLifePercentage(1.0f);
+
+	// show the enemy and resume ticking
+	SetActorHiddenInGame(false);
+	SetActorTickEnabled(true);
+	GetMesh()->SetComponentTickEnabled(true);
+
+	// rejoin the spatial registry
+	if (UCombatSpatialSubsystem* SpatialSubsystem = GetWorld()->GetSubsystem<UCombatSpatialSubsystem>())
+	{
+		SpatialSubsystem->RegisterPawn(this);
+	}
+
+	// restart StateTree
+	if (ACombatAIController* AIController = Cast<ACombatAIController>(GetController()))
+	{
+		AIController->ResumeLogic();
+	}
+}
+
+bool ACombatEnemy::IsInPool() const
+{
+	return bIsInPool;
+}
+
 float ACombatEnemy::TakeDamage(float Damage, struct FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser)
 {
 	// only process damage if the character is still alive
@@ -332,12 +449,31 @@ void ACombatEnemy::BeginPlay()
 
 	// fill the life bar
 	LifeBarWidget->SetLifePercentage(1.0f);
+
+	// save the mesh placement and capsule collision so pooled reuse can restore them
+	MeshRelativeTransform = GetMesh()->GetRelativeTransform();
+	CapsuleCollision = GetCapsuleComponent()->GetCollisionEnabled();
+
+	// add ourselves to the spatial registry so attacks can find us
+	if (UCombatSpatialSubsystem* SpatialSubsystem = GetWorld()->GetSubsystem<UCombatSpatialSubsystem>())
+	{
+		SpatialSubsystem->RegisterPawn(this);
+	}
 }
 
 void ACombatEnemy::EndPlay(EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
 
+	// drop any attack in progress
+	AttackSweep.End();
+
+	// leave the spatial registry
+	if (UCombatSpatialSubsystem* SpatialSubsystem = GetWorld()->GetSubsystem<UCombatSpatialSubsystem>())
+	{
+		SpatialSubsystem->UnregisterPawn(this);
+	}
+
 	// clear the death timer
 	GetWorld()->GetTimerManager().ClearTimer(DeathTimer);
 }
@@ -6,6 +6,7 @@
 #include "GameFramework/Character.h"
 #include "CombatAttacker.h"
 #include "CombatDamageable.h"
+#include "CombatAttackTrajectory.h"
 #include "Animation/AnimMontage.h"
 #include "Engine/TimerHandle.h"
 #include "CombatEnemy.generated.h"
@@ -13,6 +14,7 @@
 class UWidgetComponent;
 class UCombatLifeBar;
 class UAnimMontage;
+class ACombatEnemy;
 
 /** Completed attack animation delegate for StateTree */
 DECLARE_DELEGATE(FOnEnemyAttackCompleted);
@@ -23,6 +25,9 @@ DECLARE_DELEGATE(FOnEnemyLanded);
 /** Enemy died delegate */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnEnemyDied);
 
+/** Returned to pool delegate */
+DECLARE_DELEGATE_OneParam(FOnEnemyReturnedToPool, ACombatEnemy*);
+
 /**
  *  An AI-controlled character with combat capabilities.
  *  Its bundled AI Controller runs logic through StateTree
@@ -86,6 +91,13 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Melee Attack|Damage", meta = (ClampMin = 0, ClampMax = 1000, Units = "cm/s"))
 	float MeleeLaunchImpulse = 350.0f;
 
+	/** Baked attack bone paths for attack sweeps. Without one, sweeps follow the live socket */
+	UPROPERTY(EditAnywhere, Category="Melee Attack|Trace")
+	UCombatAttackTrajectory* AttackTrajectory;
+
+	/** Continuous hit detection state of the current attack sweep */
+	FCombatAttackSweep AttackSweep;
+
 	/** AnimMontage that will play for combo attacks */
 	UPROPERTY(EditAnywhere, Category="Melee Attack|Combo")
 	UAnimMontage* ComboAttackMontage;
@@ -133,6 +145,15 @@ protected:
 	/** Enemy death timer */
 	FTimerHandle DeathTimer;
 
+	/** Mesh transform relative to the capsule, restored when the enemy is reused from a pool */
+	FTransform MeshRelativeTransform;
+
+	/** Capsule collision setting, restored when the enemy is reused from a pool */
+	TEnumAsByte<ECollisionEnabled::Type> CapsuleCollision = ECollisionEnabled::QueryAndPhysics;
+
+	/** If true, the enemy is deactivated and waiting in a pool */
+	bool bIsInPool = false;
+
 	/** Attack montage ended delegate */
 	FOnMontageEnded OnAttackMontageEnded;
 
@@ -153,6 +174,9 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="Events")
 	FOnEnemyDied OnEnemyDied;
 
+	/** Returned to pool delegate. While bound, the enemy is deactivated and handed back instead of destroyed after death */
+	FOnEnemyReturnedToPool OnEnemyReturnedToPool;
+
 public:
 
 	/** Performs an AI-initiated combo attack. Number of hits will be decided by this character */
@@ -170,6 +194,18 @@ public:
 	/** Returns the last game time we were attacked */
 	float GetLastDangerTime() const;
 
+	/** Returns an attack trace carrying this character's melee damage, without a path */
+	FCombatAttackTrace MakeAttackTrace();
+
+	/** Hides and disables this enemy so it can wait in a pool. Clears ragdoll, montages and StateTree */
+	void DeactivateToPool();
+
+	/** Resets HP, life bar and movement, and reactivates a pooled enemy at the given transform */
+	void ActivateFromPool(const FTransform& SpawnTransform);
+
+	/** Returns true if this enemy is deactivated and waiting in a pool */
+	bool IsInPool() const;
+
 public:
 
 	// ~begin ICombatAttacker interface
@@ -177,6 +213,15 @@ public:
 	/** Performs an attack's collision check */
 	virtual void DoAttackTrace(FName DamageSourceBone) override;
 
+	/** Starts sweeping the attack bone's path through the montage */
+	virtual void BeginAttackSweep(FName DamageSourceBone, const UAnimMontage* Montage) override;
+
+	/** Sweeps the attack path covered since the last update */
+	virtual void UpdateAttackSweep() override;
+
+	/** Ends the attack sweep */
+	virtual void EndAttackSweep() override;
+
 	/** Performs a combo attack's check to continue the string */
 	UFUNCTION(BlueprintCallable, Category="Attacker")
 	virtual void CheckCombo() override;
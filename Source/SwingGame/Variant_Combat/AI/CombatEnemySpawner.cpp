@@ -31,6 +31,22 @@ ACombatEnemySpawner::ACombatEnemySpawner()
 void ACombatEnemySpawner::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// pre-warm the pool so wave spawns don't hitch on actor creation
+	if (IsValid(EnemyClass))
+	{
+		const int32 PrewarmCount = FMath::Min(PoolSize, SpawnCount);
+		InactiveEnemies.Reserve(PrewarmCount);
+
+		for (int32 i = 0; i < PrewarmCount; ++i)
+		{
+			if (ACombatEnemy* PooledEnemy = CreateEnemy())
+			{
+				PooledEnemy->DeactivateToPool();
+				InactiveEnemies.Add(PooledEnemy);
+			}
+		}
+	}
 	
 	// should we spawn an enemy right away?
 	if (bShouldSpawnEnemiesImmediately)
@@ -50,23 +66,53 @@ void ACombatEnemySpawner::EndPlay(EEndPlayReason::Type EndPlayReason)
 }
 
 void ACombatEnemySpawner::SpawnEnemy()
+{
+	// reuse a pooled enemy if one is waiting
+	if (InactiveEnemies.Num() > 0)
+	{
+		ACombatEnemy* PooledEnemy = InactiveEnemies.Pop(EAllowShrinking::No);
+		PooledEnemy->ActivateFromPool(SpawnCapsule->GetComponentTransform());
+		return;
+	}
+
+	// otherwise spawn a new one. If we're pooling, it will join the pool once it dies
+	CreateEnemy();
+}
+
+ACombatEnemy* ACombatEnemySpawner::CreateEnemy()
 {
 	// ensure the enemy class is valid
-	if (IsValid(EnemyClass))
+	if (!IsValid(EnemyClass))
 	{
-		// spawn the enemy at the reference capsule's transform
-		FActorSpawnParameters SpawnParams;
-		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+		return nullptr;
+	}
+
+	// spawn the enemy at the reference capsule's transform
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
 
-		ACombatEnemy* SpawnedEnemy = GetWorld()->SpawnActor<ACombatEnemy>(EnemyClass, SpawnCapsule->GetComponentTransform(), SpawnParams);
+	ACombatEnemy* SpawnedEnemy = GetWorld()->SpawnActor<ACombatEnemy>(EnemyClass, SpawnCapsule->GetComponentTransform(), SpawnParams);
 
-		// was the enemy successfully created?
-		if (SpawnedEnemy)
+	// was the enemy successfully created?
+	if (SpawnedEnemy)
+	{
+		// subscribe to the death delegate
+		SpawnedEnemy->OnEnemyDied.AddDynamic(this, &ACombatEnemySpawner::OnEnemyDied);
+
+		// have the enemy come back to us instead of being destroyed
+		if (PoolSize > 0)
 		{
-			// subscribe to the death delegate
-			SpawnedEnemy->OnEnemyDied.AddDynamic(this, &ACombatEnemySpawner::OnEnemyDied);
+			SpawnedEnemy->OnEnemyReturnedToPool.BindUObject(this, &ACombatEnemySpawner::ReturnEnemyToPool);
 		}
 	}
+
+	return SpawnedEnemy;
+}
+
+void ACombatEnemySpawner::ReturnEnemyToPool(ACombatEnemy* Enemy)
+{
+	// keep the enemy around for the next spawn
+	InactiveEnemies.Add(Enemy);
 }
 
 void ACombatEnemySpawner::OnEnemyDied()
@@ -16,6 +16,7 @@ class ACombatEnemy;
  *  Enemies will be spawned one by one, and the spawner will wait until the enemy dies before spawning a new one.
  *  The spawner can be remotely activated through the ICombatActivatable interface
  *  When the last spawned enemy dies, the spawner can also activate other ICombatActivatables
+ *  Enemies can be pooled: a few are spawned up front, deactivated, and reused after each death instead of being destroyed
  */
 UCLASS(abstract)
 class ACombatEnemySpawner : public AActor, public ICombatActivatable
@@ -50,6 +51,14 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Enemy Spawner", meta = (ClampMin = 0, ClampMax = 10))
 	float RespawnDelay = 5.0f;
 
+	/** Number of enemies to spawn on BeginPlay and reuse. Set to 0 to spawn and destroy every enemy instead */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Enemy Spawner|Pool", meta = (ClampMin = 0, ClampMax = 20))
+	int32 PoolSize = 2;
+
+	/** Deactivated enemies waiting to be spawned */
+	UPROPERTY(Transient)
+	TArray<ACombatEnemy*> InactiveEnemies;
+
 	/** Time to wait after this spawner is depleted before activating the actor list */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Activation", meta = (ClampMin = 0, ClampMax = 10))
 	float ActivationDelay = 1.0f;
@@ -79,9 +88,15 @@ public:
 
 protected:
 
-	/** Spawn an enemy and subscribe to its death event */
+	/** Spawn an enemy, reusing a pooled one if available */
 	void SpawnEnemy();
 
+	/** Spawn a new enemy actor and subscribe to its death and pool events */
+	ACombatEnemy* CreateEnemy();
+
+	/** Called when a pooled enemy has been deactivated after death */
+	void ReturnEnemyToPool(ACombatEnemy* Enemy);
+
 	/** Called when the spawned enemy has died */
 	UFUNCTION()
 	void OnEnemyDied();
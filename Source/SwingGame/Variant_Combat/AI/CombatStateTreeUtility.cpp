@@ -9,8 +9,8 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "AIController.h"
 #include "CombatEnemy.h"
-#include "Kismet/GameplayStatics.h"
 #include "StateTreeAsyncExecutionContext.h"
+#include "PlayerPerceptionSubsystem.h"
 
 bool FStateTreeCharacterGroundedCondition::TestCondition(FStateTreeExecutionContext& Context) const
 {
@@ -296,23 +296,62 @@ FText FStateTreeSetCharacterSpeedTask::GetDescription(const FGuid& ID, FStateTre
 
 ////////////////////////////////////////////////////////////////////
 
+EStateTreeRunStatus FStateTreeGetPlayerInfoTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+	// get the instance data
+	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+	// have the perception subsystem measure our distance to the players in its per-frame batch
+	if (InstanceData.ObserverHandle == INDEX_NONE)
+	{
+		if (UPlayerPerceptionSubsystem* Perception = InstanceData.Character->GetWorld()->GetSubsystem<UPlayerPerceptionSubsystem>())
+		{
+			InstanceData.ObserverHandle = Perception->RegisterObserver(InstanceData.Character);
+		}
+	}
+
+	return EStateTreeRunStatus::Running;
+}
+
+void FStateTreeGetPlayerInfoTask::ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+	// get the instance data
+	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+	// stop measuring while the state is inactive
+	if (UPlayerPerceptionSubsystem* Perception = InstanceData.Character->GetWorld()->GetSubsystem<UPlayerPerceptionSubsystem>())
+	{
+		Perception->UnregisterObserver(InstanceData.ObserverHandle);
+	}
+
+	InstanceData.ObserverHandle = INDEX_NONE;
+}
+
 EStateTreeRunStatus FStateTreeGetPlayerInfoTask::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
 {
 	// get the instance data
 	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
 
-	// get the character possessed by the first local player
-	InstanceData.TargetPlayerCharacter = Cast<ACharacter>(UGameplayStatics::GetPlayerPawn(InstanceData.Character, 0));
+	// get the nearest player character and its distance from this frame's shared perception snapshot
+	UPlayerPerceptionSubsystem* Perception = InstanceData.Character->GetWorld()->GetSubsystem<UPlayerPerceptionSubsystem>();
+
+	float Distance = 0.0f;
+	const FPerceivedPlayer* Player = Perception ? Perception->GetNearestPlayer(InstanceData.ObserverHandle, Distance) : nullptr;
+
+	InstanceData.TargetPlayerCharacter = Player ? Player->Character.Get() : nullptr;
 
 	// do we have a valid target?
 	if (InstanceData.TargetPlayerCharacter)
 	{
-		// update the last known location
-		InstanceData.TargetPlayerLocation = InstanceData.TargetPlayerCharacter->GetActorLocation();
+		// update the last known location and the distance to it
+		InstanceData.TargetPlayerLocation = Player->Location;
+		InstanceData.DistanceToTarget = Distance;
+	}
+	else
+	{
+		// keep measuring to the last known location
+		InstanceData.DistanceToTarget = FVector::Distance(InstanceData.TargetPlayerLocation, InstanceData.Character->GetActorLocation());
 	}
-
-	// update the distance
-	InstanceData.DistanceToTarget = FVector::Distance(InstanceData.TargetPlayerLocation, InstanceData.Character->GetActorLocation());
 
 	return EStateTreeRunStatus::Running;
 }
@@ -342,6 +342,9 @@ struct FStateTreeGetPlayerInfoInstanceData
 	/** Distance to the target */
 	UPROPERTY(VisibleAnywhere)
 	float DistanceToTarget = 0.0f;
+
+	/** Handle of the character in the player perception subsystem */
+	int32 ObserverHandle = INDEX_NONE;
 };
 
 /**
@@ -356,6 +359,12 @@ struct FStateTreeGetPlayerInfoTask : public FStateTreeTaskCommonBase
 	using FInstanceDataType = FStateTreeGetPlayerInfoInstanceData;
 	virtual const UStruct* GetInstanceDataType() const override { return FInstanceDataType::StaticStruct(); }
 
+	/** Runs when the owning state is entered */
+	virtual EStateTreeRunStatus EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+
+	/** Runs when the owning state is ended */
+	virtual void ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+
 	/** Runs while the owning state is active */
 	virtual EStateTreeRunStatus Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const override;
 
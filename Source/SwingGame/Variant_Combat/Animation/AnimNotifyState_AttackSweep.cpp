@@ -0,0 +1,35 @@
+#include "AnimNotifyState_AttackSweep.h"
+#include "CombatAttacker.h"
+#include "Animation/AnimMontage.h"
+#include "Components/SkeletalMeshComponent.h"
+
+void UAnimNotifyState_AttackSweep::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference)
+{
+	// cast the owner to the attacker interface
+	if (ICombatAttacker* AttackerInterface = Cast<ICombatAttacker>(MeshComp->GetOwner()))
+	{
+		AttackerInterface->BeginAttackSweep(AttackBoneName, Cast<UAnimMontage>(Animation));
+	}
+}
+
+void UAnimNotifyState_AttackSweep::NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference)
+{
+	if (ICombatAttacker* AttackerInterface = Cast<ICombatAttacker>(MeshComp->GetOwner()))
+	{
+		AttackerInterface->UpdateAttackSweep();
+	}
+}
+
+void UAnimNotifyState_AttackSweep::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+	if (ICombatAttacker* AttackerInterface = Cast<ICombatAttacker>(MeshComp->GetOwner()))
+	{
+		AttackerInterface->UpdateAttackSweep();
+		AttackerInterface->EndAttackSweep();
+	}
+}
+
+FString UAnimNotifyState_AttackSweep::GetNotifyName_Implementation() const
+{
+	return FString("Attack Sweep");
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimNotifies/AnimNotifyState.h"
+#include "AnimNotifyState_AttackSweep.generated.h"
+
+/**
+ *  AnimNotifyState to tell the actor to sweep the attack bone's path every frame of the window,
+ *  damaging each target once. Place it over the active frames of the swing.
+ */
+UCLASS()
+class UAnimNotifyState_AttackSweep : public UAnimNotifyState
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** Source bone for the attack sweep */
+	UPROPERTY(EditAnywhere, Category="Attack")
+	FName AttackBoneName;
+
+public:
+
+	/** Starts the attack sweep */
+	virtual void NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
+
+	/** Sweeps the path covered this frame */
+	virtual void NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference) override;
+
+	/** Sweeps the rest of the path and ends the attack sweep */
+	virtual void NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+
+	/** Get the notify name */
+	virtual FString GetNotifyName_Implementation() const override;
+};
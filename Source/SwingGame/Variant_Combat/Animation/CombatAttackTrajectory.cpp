@@ -0,0 +1,212 @@
+#include "CombatAttackTrajectory.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
+#include "Animation/AnimSequence.h"
+#include "Components/SkeletalMeshComponent.h"
+
+namespace
+{
+	/** Longest montage time gap swept in one update; larger jumps are section changes */
+	constexpr float MaxSweepGap = 0.25f;
+}
+
+FVector FCombatBoneTrajectory::GetLocation(float Time) const
+{
+	if (Samples.IsEmpty())
+	{
+		return FVector::ZeroVector;
+	}
+
+	const float SampleIndex = FMath::Clamp(Time * SampleRate, 0.0f, float(Samples.Num() - 1));
+	const int32 Index = FMath::FloorToInt(SampleIndex);
+	const int32 NextIndex = FMath::Min(Index + 1, Samples.Num() - 1);
+
+	return FVector(FMath::Lerp(Samples[Index], Samples[NextIndex], SampleIndex - Index));
+}
+
+int32 UCombatAttackTrajectory::FindTrajectory(const UAnimMontage* Montage, FName BoneName) const
+{
+	return Trajectories.IndexOfByPredicate([Montage, BoneName](const FCombatBoneTrajectory& Trajectory)
+	{
+		return Trajectory.Montage == Montage && Trajectory.BoneName == BoneName;
+	});
+}
+
+#if WITH_EDITOR
+
+void UCombatAttackTrajectory::Bake()
+{
+	Modify();
+	Trajectories.Reset();
+
+	for (const UAnimMontage* Montage : Montages)
+	{
+		// attacks play from the montage's first slot track
+		if (!Montage || Montage->SlotAnimTracks.IsEmpty() || !Montage->GetSkeleton())
+		{
+			continue;
+		}
+
+		const FAnimTrack& Track = Montage->SlotAnimTracks[0].AnimTrack;
+		const FReferenceSkeleton& RefSkeleton = Montage->GetSkeleton()->GetReferenceSkeleton();
+		const float PlayLength = Montage->GetPlayLength();
+
+		for (const FName BoneName : BoneNames)
+		{
+			const int32 BoneIndex = RefSkeleton.FindBoneIndex(BoneName);
+
+			if (BoneIndex == INDEX_NONE)
+			{
+				continue;
+			}
+
+			FCombatBoneTrajectory& Trajectory = Trajectories.AddDefaulted_GetRef();
+			Trajectory.Montage = Montage;
+			Trajectory.BoneName = BoneName;
+			Trajectory.SampleRate = SampleRate;
+
+			const int32 NumSamples = FMath::CeilToInt(PlayLength * SampleRate) + 1;
+			Trajectory.Samples.Reserve(NumSamples);
+
+			for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+			{
+				const float Time = FMath::Min(SampleIndex / SampleRate, PlayLength);
+
+				// find the sequence playing at this montage time
+				float AnimTime = 0.0f;
+				const FAnimSegment* Segment = Track.GetSegmentAtTime(Time);
+				const UAnimSequence* Sequence = Segment ? Cast<UAnimSequence>(Segment->GetAnimationData(Time, AnimTime)) : nullptr;
+
+				if (!Sequence)
+				{
+					// gaps and composites hold the previous location
+					Trajectory.Samples.Add(Trajectory.Samples.IsEmpty() ? FVector3f::ZeroVector : Trajectory.Samples.Last());
+					continue;
+				}
+
+				// accumulate local transforms up to the root for the component space location
+				FTransform ComponentTransform = FTransform::Identity;
+
+				for (int32 Bone = BoneIndex; Bone != INDEX_NONE; Bone = RefSkeleton.GetParentIndex(Bone))
+				{
+					FTransform LocalTransform;
+
+					// root motion moves the actor instead; the mesh keeps the root at its reference pose
+					if (Bone == 0 && Sequence->bEnableRootMotion)
+					{
+						LocalTransform = RefSkeleton.GetRefBonePose()[0];
+					}
+					else
+					{
+						Sequence->GetBoneTransform(LocalTransform, FSkeletonPoseBoneIndex(Bone), AnimTime, true);
+					}
+
+					ComponentTransform = ComponentTransform * LocalTransform;
+				}
+
+				Trajectory.Samples.Add(FVector3f(ComponentTransform.GetLocation()));
+			}
+		}
+	}
+}
+
+#endif
+
+void FCombatAttackSweep::Begin(const USkeletalMeshComponent* Mesh, const UAnimMontage* InMontage, FName InBoneName, const UCombatAttackTrajectory* InTrajectories)
+{
+	Montage = InMontage;
+	BoneName = InBoneName;
+	Trajectories = InTrajectories;
+	TrajectoryIndex = InTrajectories ? InTrajectories->FindTrajectory(InMontage, InBoneName) : INDEX_NONE;
+
+	const UAnimInstance* AnimInstance = Mesh ? Mesh->GetAnimInstance() : nullptr;
+	LastTime = AnimInstance ? AnimInstance->Montage_GetPosition(InMontage) : 0.0f;
+	LastLocation = Mesh ? Mesh->GetSocketLocation(InBoneName) : FVector::ZeroVector;
+
+	HitActors = MakeShared<TSet<FObjectKey>>();
+}
+
+void FCombatAttackSweep::Update(const USkeletalMeshComponent* Mesh, const FCombatAttackTrace& Template)
+{
+	if (!IsActive() || !Mesh)
+	{
+		return;
+	}
+
+	UWorld* World = Mesh->GetWorld();
+
+	auto QueueSegment = [&](const FVector& From, const FVector& To)
+	{
+		FCombatAttackTrace Trace = Template;
+		Trace.Start = From;
+		Trace.End = To;
+		Trace.HitActors = HitActors;
+
+		UCombatHitSubsystem::QueueAttackTrace(World, MoveTemp(Trace));
+	};
+
+	const FCombatBoneTrajectory* Trajectory = GetTrajectory();
+	const UAnimInstance* AnimInstance = Mesh->GetAnimInstance();
+
+	// no baked path: sweep between the live socket locations
+	if (!Trajectory || !AnimInstance)
+	{
+		const FVector Location = Mesh->GetSocketLocation(BoneName);
+		QueueSegment(LastLocation, Location);
+		LastLocation = Location;
+		return;
+	}
+
+	const float Time = AnimInstance->Montage_GetPosition(Montage.Get());
+
+	// restart after a section jump instead of sweeping the skipped part
+	if (Time <= LastTime || Time - LastTime > MaxSweepGap)
+	{
+		LastTime = Time;
+		return;
+	}
+
+	// baked samples are relative to the mesh; place them with its current transform
+	const FTransform& MeshTransform = Mesh->GetComponentTransform();
+	const float SampleStep = 1.0f / Trajectory->SampleRate;
+
+	FVector From = MeshTransform.TransformPosition(Trajectory->GetLocation(LastTime));
+
+	// one sweep per baked sample covered, so curved swings are followed closely
+	for (float SampleTime = (FMath::FloorToFloat(LastTime / SampleStep) + 1.0f) * SampleStep; ; SampleTime += SampleStep)
+	{
+		const float SegmentEndTime = FMath::Min(SampleTime, Time);
+		const FVector To = MeshTransform.TransformPosition(Trajectory->GetLocation(SegmentEndTime));
+
+		QueueSegment(From, To);
+		From = To;
+
+		if (SegmentEndTime >= Time)
+		{
+			break;
+		}
+	}
+
+	LastTime = Time;
+	LastLocation = From;
+}
+
+void FCombatAttackSweep::End()
+{
+	HitActors.Reset();
+	Montage.Reset();
+	Trajectories.Reset();
+	TrajectoryIndex = INDEX_NONE;
+}
+
+const FCombatBoneTrajectory* FCombatAttackSweep::GetTrajectory() const
+{
+	const UCombatAttackTrajectory* Asset = Trajectories.Get();
+
+	if (!Asset || !Asset->Trajectories.IsValidIndex(TrajectoryIndex) || Asset->Trajectories[TrajectoryIndex].SampleRate <= 0.0f)
+	{
+		return nullptr;
+	}
+
+	return &Asset->Trajectories[TrajectoryIndex];
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "UObject/ObjectKey.h"
+#include "CombatHitSubsystem.h"
+#include "CombatAttackTrajectory.generated.h"
+
+class UAnimMontage;
+class USkeletalMeshComponent;
+
+/**
+ *  Path of one bone through an attack montage, sampled at a fixed rate in mesh component space
+ */
+USTRUCT()
+struct FCombatBoneTrajectory
+{
+	GENERATED_BODY()
+
+	/** Montage the path was sampled from */
+	UPROPERTY(VisibleAnywhere, Category="Trajectory")
+	TObjectPtr<const UAnimMontage> Montage;
+
+	/** Bone the path follows */
+	UPROPERTY(VisibleAnywhere, Category="Trajectory")
+	FName BoneName;
+
+	/** Samples per second of montage time */
+	UPROPERTY(VisibleAnywhere, Category="Trajectory")
+	float SampleRate = 0.0f;
+
+	/** Bone location at each sample, relative to the skeletal mesh component */
+	UPROPERTY(VisibleAnywhere, Category="Trajectory")
+	TArray<FVector3f> Samples;
+
+	/** Returns the interpolated bone location at the given montage time */
+	FVector GetLocation(float Time) const;
+};
+
+/**
+ *  Attack bone paths baked from attack montages.
+ *  List the montages and damage source bones, then press Bake. Attack sweeps read the path from
+ *  here instead of evaluating sockets, so fast swings are swept across their whole arc.
+ */
+UCLASS(BlueprintType)
+class UCombatAttackTrajectory : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Attack montages to bake */
+	UPROPERTY(EditAnywhere, Category="Bake")
+	TArray<TObjectPtr<UAnimMontage>> Montages;
+
+	/** Damage source bones to bake in every montage */
+	UPROPERTY(EditAnywhere, Category="Bake")
+	TArray<FName> BoneNames;
+
+	/** Samples per second of montage time */
+	UPROPERTY(EditAnywhere, Category="Bake", meta = (ClampMin = 30, ClampMax = 480, Units = "Hz"))
+	float SampleRate = 120.0f;
+
+	/** Baked paths, one per montage and bone */
+	UPROPERTY(VisibleAnywhere, Category="Baked")
+	TArray<FCombatBoneTrajectory> Trajectories;
+
+	/** Returns the index of the path baked for the given montage and bone, or INDEX_NONE */
+	int32 FindTrajectory(const UAnimMontage* Montage, FName BoneName) const;
+
+#if WITH_EDITOR
+
+	/** Samples every listed bone through every listed montage */
+	UFUNCTION(CallInEditor, Category="Bake")
+	void Bake();
+
+#endif
+};
+
+/**
+ *  Continuous hit detection for one attack window.
+ *  Each update sweeps the damage source bone's path since the previous one, along the baked
+ *  trajectory when there is one and the live socket otherwise. Targets are damaged once per attack.
+ */
+struct FCombatAttackSweep
+{
+	/** Starts sweeping the bone's path through the montage */
+	void Begin(const USkeletalMeshComponent* Mesh, const UAnimMontage* InMontage, FName InBoneName, const UCombatAttackTrajectory* InTrajectories);
+
+	/** Queues sweeps for the path covered since the last update. Template provides everything but the path */
+	void Update(const USkeletalMeshComponent* Mesh, const FCombatAttackTrace& Template);
+
+	/** Ends the attack window */
+	void End();
+
+	/** Returns true while an attack window is open */
+	bool IsActive() const { return HitActors.IsValid(); }
+
+private:
+
+	/** Returns the baked path being followed, if any */
+	const FCombatBoneTrajectory* GetTrajectory() const;
+
+	TWeakObjectPtr<const UAnimMontage> Montage;
+	FName BoneName;
+
+	TWeakObjectPtr<const UCombatAttackTrajectory> Trajectories;
+	int32 TrajectoryIndex = INDEX_NONE;
+
+	/** Montage time and world bone location at the last update */
+	float LastTime = 0.0f;
+	FVector LastLocation = FVector::ZeroVector;
+
+	/** Targets already damaged by this attack */
+	TSharedPtr<TSet<FObjectKey>> HitActors;
+};
@@ -15,6 +15,8 @@
 #include "TimerManager.h"
 #include "Engine/LocalPlayer.h"
 #include "CombatPlayerController.h"
+#include "CombatHitSubsystem.h"
+#include "CombatSpatialSubsystem.h"
 
 ACombatCharacter::ACombatCharacter()
 {
@@ -252,49 +254,54 @@ void ACombatCharacter::AttackMontageEnded(UAnimMontage* Montage, bool bInterrupt
 	}
 }
 
-void ACombatCharacter::DoAttackTrace(FName DamageSourceBone)
+FCombatAttackTrace ACombatCharacter::MakeAttackTrace()
 {
-	// sweep for objects in front of the character to be hit by the attack
-	TArray<FHitResult> OutHits;
+	FCombatAttackTrace Trace;
+	Trace.Attacker = this;
 
-	// start at the provided socket location, sweep forward
-	const FVector TraceStart = GetMesh()->GetSocketLocation(DamageSourceBone);
-	const FVector TraceEnd = TraceStart + (GetActorForwardVector() * MeleeTraceDistance);
+	// use a sphere shape for the sweep
+	Trace.Radius = MeleeTraceRadius;
 
 	// check for pawn and world dynamic collision object types
-	FCollisionObjectQueryParams ObjectParams;
-	ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
-	ObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+	Trace.ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
+	Trace.ObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
 
-	// use a sphere shape for the sweep
-	FCollisionShape CollisionShape;
-	CollisionShape.SetSphere(MeleeTraceRadius);
+	Trace.Damage = MeleeDamage;
+	Trace.KnockbackImpulse = MeleeKnockbackImpulse;
+	Trace.LaunchImpulse = MeleeLaunchImpulse;
 
-	// ignore self
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(this);
+	// call the BP handler to play effects, etc. for every damageable actor hit
+	Trace.OnHit.BindUObject(this, &ACombatCharacter::DealtDamage);
 
-	if (GetWorld()->SweepMultiByObjectType(OutHits, TraceStart, TraceEnd, FQuat::Identity, ObjectParams, CollisionShape, QueryParams))
-	{
-		// iterate over each object hit
-		for (const FHitResult& CurrentHit : OutHits)
-		{
-			// check if we've hit a damageable actor
-			ICombatDamageable* Damageable = Cast<ICombatDamageable>(CurrentHit.GetActor());
+	return Trace;
+}
 
-			if (Damageable)
-			{
-				// knock upwards and away from the impact normal
-				const FVector Impulse = (CurrentHit.ImpactNormal * -MeleeKnockbackImpulse) + (FVector::UpVector * MeleeLaunchImpulse);
+void ACombatCharacter::DoAttackTrace(FName DamageSourceBone)
+{
+	// sweep for objects in front of the character to be hit by the attack
+	FCombatAttackTrace Trace = MakeAttackTrace();
 
-				// pass the damage event to the actor
-				Damageable->ApplyDamage(MeleeDamage, this, CurrentHit.ImpactPoint, Impulse);
+	// start at the provided socket location, sweep forward
+	Trace.Start = GetMesh()->GetSocketLocation(DamageSourceBone);
+	Trace.End = Trace.Start + (GetActorForwardVector() * MeleeTraceDistance);
 
-				// call the BP handler to play effects, etc.
-				DealtDamage(MeleeDamage, CurrentHit.ImpactPoint);
-			}
-		}
-	}
+	// the hit subsystem sweeps along with the rest of the frame's attacks and applies the damage
+	UCombatHitSubsystem::QueueAttackTrace(GetWorld(), MoveTemp(Trace));
+}
+
+void ACombatCharacter::BeginAttackSweep(FName DamageSourceBone, const UAnimMontage* Montage)
+{
+	AttackSweep.Begin(GetMesh(), Montage, DamageSourceBone, AttackTrajectory);
+}
+
+void ACombatCharacter::UpdateAttackSweep()
+{
+	AttackSweep.Update(GetMesh(), MakeAttackTrace());
+}
+
+void ACombatCharacter::EndAttackSweep()
+{
+	AttackSweep.End();
 }
 
 void ACombatCharacter::CheckCombo()
@@ -341,38 +348,30 @@ void ACombatCharacter::CheckChargedAttack()
 
 void ACombatCharacter::NotifyEnemiesOfIncomingAttack()
 {
-	// sweep for objects in front of the character to be hit by the attack
-	TArray<FHitResult> OutHits;
+	// find the pawns in front of the character through the spatial registry instead of a physics sweep
+	UCombatSpatialSubsystem* SpatialSubsystem = GetWorld()->GetSubsystem<UCombatSpatialSubsystem>();
+
+	if (!SpatialSubsystem)
+	{
+		return;
+	}
 
 	// start at the actor location, sweep forward
 	const FVector TraceStart = GetActorLocation();
 	const FVector TraceEnd = TraceStart + (GetActorForwardVector() * DangerTraceDistance);
 
-	// check for pawn object types only
-	FCollisionObjectQueryParams ObjectParams;
-	ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
-
-	// use a sphere shape for the sweep
-	FCollisionShape CollisionShape;
-	CollisionShape.SetSphere(DangerTraceRadius);
-
 	// ignore self
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(this);
+	TArray<APawn*> OutPawns;
+	SpatialSubsystem->QueryCapsule(TraceStart, TraceEnd, DangerTraceRadius, this, OutPawns);
 
-	if (GetWorld()->SweepMultiByObjectType(OutHits, TraceStart, TraceEnd, FQuat::Identity, ObjectParams, CollisionShape, QueryParams))
+	// iterate over each pawn found
+	for (APawn* CurrentPawn : OutPawns)
 	{
-		// iterate over each object hit
-		for (const FHitResult& CurrentHit : OutHits)
+		// check if we've found a damageable actor
+		if (ICombatDamageable* Damageable = Cast<ICombatDamageable>(CurrentPawn))
 		{
-			// check if we've hit a damageable actor
-			ICombatDamageable* Damageable = Cast<ICombatDamageable>(CurrentHit.GetActor());
-
-			if (Damageable)
-			{
-				// notify the enemy
-				Damageable->NotifyDanger(GetActorLocation(), this);
-			}
+			// notify the enemy
+			Damageable->NotifyDanger(GetActorLocation(), this);
 		}
 	}
 }
@@ -404,6 +403,9 @@ void ACombatCharacter::ApplyDamage(float Damage, AActor* DamageCauser, const FVe
 
 void ACombatCharacter::HandleDeath()
 {
+	// stop any attack in progress
+	AttackSweep.End();
+
 	// disable movement while we're dead
 	GetCharacterMovement()->DisableMovement();
 
@@ -493,6 +495,12 @@ void ACombatCharacter::BeginPlay()
 	// save the relative transform for the mesh so we can reset the ragdoll later
 	MeshStartingTransform = GetMesh()->GetRelativeTransform();
 
+	// add ourselves to the spatial registry so enemies can find us
+	if (UCombatSpatialSubsystem* SpatialSubsystem = GetWorld()->GetSubsystem<UCombatSpatialSubsystem>())
+	{
+		SpatialSubsystem->RegisterPawn(this);
+	}
+
 	// set the life bar color
 	LifeBarWidget->SetBarColor(LifeBarColor);
 
@@ -504,6 +512,15 @@ void ACombatCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
 
+	// drop any attack in progress
+	AttackSweep.End();
+
+	// leave the spatial registry
+	if (UCombatSpatialSubsystem* SpatialSubsystem = GetWorld()->GetSubsystem<UCombatSpatialSubsystem>())
+	{
+		SpatialSubsystem->UnregisterPawn(this);
+	}
+
 	// clear the respawn timer
 	GetWorld()->GetTimerManager().ClearTimer(RespawnTimer);
 }
@@ -6,6 +6,7 @@
 #include "GameFramework/Character.h"
 #include "CombatAttacker.h"
 #include "CombatDamageable.h"
+#include "CombatAttackTrajectory.h"
 #include "Animation/AnimInstance.h"
 #include "CombatCharacter.generated.h"
 
@@ -131,6 +132,13 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Melee Attack|Damage", meta = (ClampMin = 0, ClampMax = 1000, Units = "cm/s"))
 	float MeleeLaunchImpulse = 300.0f;
 
+	/** Baked attack bone paths for attack sweeps. Without one, sweeps follow the live socket */
+	UPROPERTY(EditAnywhere, Category="Melee Attack|Trace")
+	UCombatAttackTrajectory* AttackTrajectory;
+
+	/** Continuous hit detection state of the current attack sweep */
+	FCombatAttackSweep AttackSweep;
+
 	/** AnimMontage that will play for combo attacks */
 	UPROPERTY(EditAnywhere, Category="Melee Attack|Combo")
 	UAnimMontage* ComboAttackMontage;
@@ -254,6 +262,9 @@ protected:
 	/** Called from a delegate when the attack montage ends */
 	void AttackMontageEnded(UAnimMontage* Montage, bool bInterrupted);
 
+	/** Returns an attack trace carrying this character's melee damage, without a path */
+	FCombatAttackTrace MakeAttackTrace();
+
 	
 public:
 
@@ -262,6 +273,15 @@ public:
 	/** Performs the collision check for an attack */
 	virtual void DoAttackTrace(FName DamageSourceBone) override;
 
+	/** Starts sweeping the attack bone's path through the montage */
+	virtual void BeginAttackSweep(FName DamageSourceBone, const UAnimMontage* Montage) override;
+
+	/** Sweeps the attack path covered since the last update */
+	virtual void UpdateAttackSweep() override;
+
+	/** Ends the attack sweep */
+	virtual void EndAttackSweep() override;
+
 	/** Performs the combo string check */
 	virtual void CheckCombo() override;
 
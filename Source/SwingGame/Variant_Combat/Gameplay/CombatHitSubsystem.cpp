@@ -0,0 +1,146 @@
+#include "CombatHitSubsystem.h"
+#include "CombatDamageable.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<bool> CVarCombatBatchedAttackTraces(
+	TEXT("Combat.BatchedAttackTraces"),
+	true,
+	TEXT("Resolve melee attack traces as one batch of async sweeps per frame. When off, each attack sweeps as its notify fires."));
+
+void UCombatHitSubsystem::QueueAttackTrace(UWorld* World, FCombatAttackTrace&& Trace)
+{
+	if (!World)
+	{
+		return;
+	}
+
+	UCombatHitSubsystem* HitSubsystem = World->GetSubsystem<UCombatHitSubsystem>();
+
+	if (!HitSubsystem || !CVarCombatBatchedAttackTraces.GetValueOnGameThread())
+	{
+		ResolveNow(World, Trace);
+		return;
+	}
+
+	HitSubsystem->QueuedTraces.Add(MoveTemp(Trace));
+}
+
+void UCombatHitSubsystem::Tick(float DeltaTime)
+{
+	UWorld* World = GetWorld();
+
+	// apply last frame's sweeps in the order their attacks were queued
+	for (const FPendingTrace& Pending : PendingTraces)
+	{
+		FTraceDatum TraceData;
+
+		if (World->QueryTraceData(Pending.Handle, TraceData))
+		{
+			ApplyHits(Pending.Trace, TraceData.OutHits);
+		}
+	}
+
+	PendingTraces.Reset();
+
+	// issue this frame's sweeps together so the engine can run them on worker threads
+	for (FCombatAttackTrace& Trace : QueuedTraces)
+	{
+		FPendingTrace& Pending = PendingTraces.AddDefaulted_GetRef();
+
+		Pending.Handle = World->AsyncSweepByObjectType(EAsyncTraceType::Multi, Trace.Start, Trace.End, FQuat::Identity, Trace.ObjectParams, FCollisionShape::MakeSphere(Trace.Radius), MakeQueryParams(Trace));
+		Pending.Trace = MoveTemp(Trace);
+	}
+
+	QueuedTraces.Reset();
+}
+
+TStatId UCombatHitSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCombatHitSubsystem, STATGROUP_Tickables);
+}
+
+void UCombatHitSubsystem::Deinitialize()
+{
+	QueuedTraces.Empty();
+	PendingTraces.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UCombatHitSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCombatHitSubsystem::ResolveNow(UWorld* World, const FCombatAttackTrace& Trace)
+{
+	TArray<FHitResult> OutHits;
+
+	if (World->SweepMultiByObjectType(OutHits, Trace.Start, Trace.End, FQuat::Identity, Trace.ObjectParams, FCollisionShape::MakeSphere(Trace.Radius), MakeQueryParams(Trace)))
+	{
+		ApplyHits(Trace, OutHits);
+	}
+}
+
+void UCombatHitSubsystem::ApplyHits(const FCombatAttackTrace& Trace, TConstArrayView<FHitResult> Hits)
+{
+	// the attacker may have been destroyed while its sweep was in flight
+	AActor* Attacker = Trace.Attacker.Get();
+
+	if (!Attacker)
+	{
+		return;
+	}
+
+	// iterate over each object hit
+	for (const FHitResult& CurrentHit : Hits)
+	{
+		AActor* HitActor = CurrentHit.GetActor();
+
+		if (!IsValid(HitActor))
+		{
+			continue;
+		}
+
+		// skip actors missing the required tag
+		if (!Trace.RequiredTag.IsNone() && !HitActor->ActorHasTag(Trace.RequiredTag))
+		{
+			continue;
+		}
+
+		// check if we've hit a damageable actor
+		if (ICombatDamageable* Damageable = Cast<ICombatDamageable>(HitActor))
+		{
+			// damage each target only once per attack
+			if (Trace.HitActors.IsValid())
+			{
+				bool bAlreadyHit = false;
+				Trace.HitActors->Add(FObjectKey(HitActor), &bAlreadyHit);
+
+				if (bAlreadyHit)
+				{
+					continue;
+				}
+			}
+
+			// knock upwards and away from the impact normal
+			const FVector Impulse = (CurrentHit.ImpactNormal * -Trace.KnockbackImpulse) + (FVector::UpVector * Trace.LaunchImpulse);
+
+			// pass the damage event to the actor
+			Damageable->ApplyDamage(Trace.Damage, Attacker, CurrentHit.ImpactPoint, Impulse);
+
+			// let the attacker react to the hit
+			Trace.OnHit.ExecuteIfBound(Trace.Damage, CurrentHit.ImpactPoint);
+		}
+	}
+}
+
+FCollisionQueryParams UCombatHitSubsystem::MakeQueryParams(const FCombatAttackTrace& Trace)
+{
+	// ignore the attacker
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(CombatAttackTrace));
+	QueryParams.AddIgnoredActor(Trace.Attacker.Get());
+
+	return QueryParams;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "UObject/ObjectKey.h"
+#include "CombatHitSubsystem.generated.h"
+
+/** Called for every damageable actor an attack trace hits */
+DECLARE_DELEGATE_TwoParams(FOnCombatAttackHit, float /*Damage*/, const FVector& /*ImpactPoint*/);
+
+/**
+ *  A melee attack sweep and the damage it deals to the damageable actors it hits
+ */
+struct FCombatAttackTrace
+{
+	/** Actor dealing the damage. Ignored by the sweep */
+	TWeakObjectPtr<AActor> Attacker;
+
+	/** Sphere sweep from Start to End */
+	FVector Start = FVector::ZeroVector;
+	FVector End = FVector::ZeroVector;
+	float Radius = 0.0f;
+
+	/** Collision object types the sweep looks for */
+	FCollisionObjectQueryParams ObjectParams;
+
+	/** If set, only actors with this tag are damaged */
+	FName RequiredTag;
+
+	/** Damage and knockback applied to each damageable actor hit */
+	float Damage = 0.0f;
+	float KnockbackImpulse = 0.0f;
+	float LaunchImpulse = 0.0f;
+
+	/** Optional attacker-side handler, e.g. to play damage dealt effects */
+	FOnCombatAttackHit OnHit;
+
+	/** Optional set shared by all traces of one attack, so each target is damaged only once */
+	TSharedPtr<TSet<FObjectKey>> HitActors;
+};
+
+/**
+ *  Resolves melee attack traces in one batch per frame.
+ *  Attack notifies queue their sweeps here instead of sweeping on the spot. Once per frame the
+ *  subsystem issues the whole batch as async scene queries, which the engine runs in parallel on
+ *  worker threads, and applies their damage the next frame in the order the attacks were queued.
+ */
+UCLASS()
+class UCombatHitSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Queues an attack trace. Resolves it immediately if batching is disabled or the world has no subsystem */
+	static void QueueAttackTrace(UWorld* World, FCombatAttackTrace&& Trace);
+
+	/** Applies last frame's traces and issues this frame's */
+	virtual void Tick(float DeltaTime) override;
+
+	/** Returns the stat ID for this tickable */
+	virtual TStatId GetStatId() const override;
+
+	/** Drops any pending traces */
+	virtual void Deinitialize() override;
+
+protected:
+
+	/** Only game worlds resolve attacks */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	/** Sweeps and applies a trace on the calling thread */
+	static void ResolveNow(UWorld* World, const FCombatAttackTrace& Trace);
+
+	/** Applies a trace's damage and knockback to every damageable actor it hit */
+	static void ApplyHits(const FCombatAttackTrace& Trace, TConstArrayView<FHitResult> Hits);
+
+	/** Query params shared by the immediate and batched paths */
+	static FCollisionQueryParams MakeQueryParams(const FCombatAttackTrace& Trace);
+
+	/** An issued trace waiting for its results */
+	struct FPendingTrace
+	{
+		FCombatAttackTrace Trace;
+		FTraceHandle Handle;
+	};
+
+	/** Traces queued this frame, not issued yet */
+	TArray<FCombatAttackTrace> QueuedTraces;
+
+	/** Traces issued last frame, in queue order */
+	TArray<FPendingTrace> PendingTraces;
+};
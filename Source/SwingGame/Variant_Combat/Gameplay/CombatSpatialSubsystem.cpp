@@ -0,0 +1,172 @@
+#include "CombatSpatialSubsystem.h"
+#include "GameFramework/Pawn.h"
+#include "Math/VectorRegister.h"
+
+namespace
+{
+	/** Returns a bitmask with one bit per valid lane of the four-pawn block starting at Index */
+	int32 ValidLaneMask(int32 Index, int32 Num)
+	{
+		return (1 << FMath::Min(Num - Index, 4)) - 1;
+	}
+}
+
+void UCombatSpatialSubsystem::RegisterPawn(APawn* Pawn)
+{
+	if (!Pawn || Pawns.Contains(Pawn))
+	{
+		return;
+	}
+
+	const int32 Index = Pawns.Add(Pawn);
+
+	// keep the data arrays padded to whole SIMD blocks
+	const int32 PaddedNum = Align(Pawns.Num(), 4);
+
+	LocationX.SetNumZeroed(PaddedNum);
+	LocationY.SetNumZeroed(PaddedNum);
+	LocationZ.SetNumZeroed(PaddedNum);
+	CapsuleRadius.SetNumZeroed(PaddedNum);
+	CapsuleHalfHeight.SetNumZeroed(PaddedNum);
+
+	// fill the slot right away so the pawn can be found before the next tick
+	WriteSlot(Index, Pawn);
+}
+
+void UCombatSpatialSubsystem::UnregisterPawn(APawn* Pawn)
+{
+	const int32 Index = Pawns.Find(Pawn);
+
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	// move the last pawn into the freed slot
+	const int32 LastIndex = Pawns.Num() - 1;
+
+	Pawns.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+	LocationX[Index] = LocationX[LastIndex];
+	LocationY[Index] = LocationY[LastIndex];
+	LocationZ[Index] = LocationZ[LastIndex];
+	CapsuleRadius[Index] = CapsuleRadius[LastIndex];
+	CapsuleHalfHeight[Index] = CapsuleHalfHeight[LastIndex];
+
+	// zero the vacated slot so the padding stays clean
+	LocationX[LastIndex] = LocationY[LastIndex] = LocationZ[LastIndex] = 0.0f;
+	CapsuleRadius[LastIndex] = CapsuleHalfHeight[LastIndex] = 0.0f;
+}
+
+void UCombatSpatialSubsystem::QueryCapsule(const FVector& Start, const FVector& End, float Radius, const AActor* IgnoredActor, TArray<APawn*>& OutPawns) const
+{
+	OutPawns.Reset();
+
+	const FVector3f Segment(End - Start);
+	const float SegmentSizeSquared = Segment.SizeSquared();
+	const float InvSegmentSizeSquared = SegmentSizeSquared > UE_SMALL_NUMBER ? 1.0f / SegmentSizeSquared : 0.0f;
+
+	const VectorRegister4Float StartX = VectorSetFloat1(static_cast<float>(Start.X));
+	const VectorRegister4Float StartY = VectorSetFloat1(static_cast<float>(Start.Y));
+	const VectorRegister4Float StartZ = VectorSetFloat1(static_cast<float>(Start.Z));
+	const VectorRegister4Float SegmentX = VectorSetFloat1(Segment.X);
+	const VectorRegister4Float SegmentY = VectorSetFloat1(Segment.Y);
+	const VectorRegister4Float SegmentZ = VectorSetFloat1(Segment.Z);
+	const VectorRegister4Float InvSizeSquared = VectorSetFloat1(InvSegmentSizeSquared);
+	const VectorRegister4Float QueryRadius = VectorSetFloat1(Radius);
+	const VectorRegister4Float Zero = VectorZeroFloat();
+	const VectorRegister4Float One = VectorOneFloat();
+
+	for (int32 Index = 0; Index < Pawns.Num(); Index += 4)
+	{
+		// offset from the sweep start to each pawn
+		const VectorRegister4Float DeltaX = VectorSubtract(VectorLoad(&LocationX[Index]), StartX);
+		const VectorRegister4Float DeltaY = VectorSubtract(VectorLoad(&LocationY[Index]), StartY);
+		const VectorRegister4Float DeltaZ = VectorSubtract(VectorLoad(&LocationZ[Index]), StartZ);
+
+		// project each pawn onto the sweep segment
+		VectorRegister4Float Alpha = VectorMultiply(DeltaX, SegmentX);
+		Alpha = VectorMultiplyAdd(DeltaY, SegmentY, Alpha);
+		Alpha = VectorMultiplyAdd(DeltaZ, SegmentZ, Alpha);
+		Alpha = VectorMin(VectorMax(VectorMultiply(Alpha, InvSizeSquared), Zero), One);
+
+		// offset from the closest point on the segment to each pawn
+		const VectorRegister4Float OffsetX = VectorNegateMultiplyAdd(Alpha, SegmentX, DeltaX);
+		const VectorRegister4Float OffsetY = VectorNegateMultiplyAdd(Alpha, SegmentY, DeltaY);
+
+		// the capsule's vertical extent absorbs height differences up to its half height
+		const VectorRegister4Float OffsetZ = VectorMax(VectorSubtract(VectorAbs(VectorNegateMultiplyAdd(Alpha, SegmentZ, DeltaZ)), VectorLoad(&CapsuleHalfHeight[Index])), Zero);
+
+		VectorRegister4Float DistanceSquared = VectorMultiply(OffsetX, OffsetX);
+		DistanceSquared = VectorMultiplyAdd(OffsetY, OffsetY, DistanceSquared);
+		DistanceSquared = VectorMultiplyAdd(OffsetZ, OffsetZ, DistanceSquared);
+
+		const VectorRegister4Float ReachRadius = VectorAdd(QueryRadius, VectorLoad(&CapsuleRadius[Index]));
+
+		int32 HitMask = VectorMaskBits(VectorCompareLE(DistanceSquared, VectorMultiply(ReachRadius, ReachRadius))) & ValidLaneMask(Index, Pawns.Num());
+
+		// gather the overlapping pawns
+		for (; HitMask; HitMask &= HitMask - 1)
+		{
+			APawn* Pawn = Pawns[Index + FMath::CountTrailingZeros(HitMask)];
+
+			if (Pawn != IgnoredActor)
+			{
+				OutPawns.Add(Pawn);
+			}
+		}
+	}
+}
+
+void UCombatSpatialSubsystem::Tick(float DeltaTime)
+{
+	// refresh every pawn's slot in one pass
+	for (int32 Index = 0; Index < Pawns.Num(); ++Index)
+	{
+		WriteSlot(Index, Pawns[Index]);
+	}
+}
+
+TStatId UCombatSpatialSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCombatSpatialSubsystem, STATGROUP_Tickables);
+}
+
+void UCombatSpatialSubsystem::Deinitialize()
+{
+	Pawns.Empty();
+	LocationX.Empty();
+	LocationY.Empty();
+	LocationZ.Empty();
+	CapsuleRadius.Empty();
+	CapsuleHalfHeight.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UCombatSpatialSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCombatSpatialSubsystem::WriteSlot(int32 Index, const APawn* Pawn)
+{
+	// pawns unregister on EndPlay, but skip any that were collected without doing so
+	if (!IsValid(Pawn))
+	{
+		return;
+	}
+
+	const FVector Location = Pawn->GetActorLocation();
+
+	LocationX[Index] = static_cast<float>(Location.X);
+	LocationY[Index] = static_cast<float>(Location.Y);
+	LocationZ[Index] = static_cast<float>(Location.Z);
+
+	float Radius = 0.0f;
+	float HalfHeight = 0.0f;
+	Pawn->GetSimpleCollisionCylinder(Radius, HalfHeight);
+
+	CapsuleRadius[Index] = Radius;
+	CapsuleHalfHeight[Index] = HalfHeight;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CombatSpatialSubsystem.generated.h"
+
+/**
+ *  Keeps the location and collision size of every combat pawn in structure-of-arrays form.
+ *  Pawns register on BeginPlay and the registry refreshes them once per frame, so spatial questions
+ *  like "which pawns are in the path of this attack" are answered by scanning four pawns per SIMD
+ *  instruction instead of sweeping the physics scene.
+ *  Queries see the pawns as they were at the end of the previous frame.
+ */
+UCLASS()
+class UCombatSpatialSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Adds a pawn to the registry. Does nothing if it's already registered */
+	void RegisterPawn(APawn* Pawn);
+
+	/** Removes a pawn from the registry */
+	void UnregisterPawn(APawn* Pawn);
+
+	/**
+	 *  Finds the pawns whose collision capsules overlap a sphere swept from Start to End.
+	 *  Matches a sphere sweep against ECC_Pawn closely enough for gameplay, without touching physics
+	 */
+	void QueryCapsule(const FVector& Start, const FVector& End, float Radius, const AActor* IgnoredActor, TArray<APawn*>& OutPawns) const;
+
+	/** Refreshes every registered pawn's location and capsule size */
+	virtual void Tick(float DeltaTime) override;
+
+	/** Returns the stat ID for this tickable */
+	virtual TStatId GetStatId() const override;
+
+	/** Clears the registry */
+	virtual void Deinitialize() override;
+
+protected:
+
+	/** Only game worlds track combat pawns */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	/** Copies a pawn's transform and capsule size into its slot */
+	void WriteSlot(int32 Index, const APawn* Pawn);
+
+	/** Registered pawns, indexing the arrays below */
+	UPROPERTY(Transient)
+	TArray<APawn*> Pawns;
+
+	/** Per-pawn data, one array per component. Padded with zeros to a multiple of four for SIMD loads */
+	TArray<float> LocationX;
+	TArray<float> LocationY;
+	TArray<float> LocationZ;
+	TArray<float> CapsuleRadius;
+	TArray<float> CapsuleHalfHeight;
+};
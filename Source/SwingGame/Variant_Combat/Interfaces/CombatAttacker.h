@@ -6,6 +6,8 @@
 #include "UObject/Interface.h"
 #include "CombatAttacker.generated.h"
 
+class UAnimMontage;
+
 /**
  *  CombatAttacker Interface
  *  Provides common functionality to trigger attack animation events.
@@ -26,6 +28,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Attacker")
 	virtual void DoAttackTrace(FName DamageSourceBone) = 0;
 
+	/** Starts continuous hit detection along the damage source bone's path through the montage. Usually called from a montage's AnimNotifyState */
+	UFUNCTION(BlueprintCallable, Category="Attacker")
+	virtual void BeginAttackSweep(FName DamageSourceBone, const UAnimMontage* Montage) = 0;
+
+	/** Sweeps the attack path covered since the last update. Usually called from a montage's AnimNotifyState */
+	UFUNCTION(BlueprintCallable, Category="Attacker")
+	virtual void UpdateAttackSweep() = 0;
+
+	/** Ends continuous hit detection. Usually called from a montage's AnimNotifyState */
+	UFUNCTION(BlueprintCallable, Category="Attacker")
+	virtual void EndAttackSweep() = 0;
+
 	/** Performs a combo attack's check to continue the string. Usually called from a montage's AnimNotify */
 	UFUNCTION(BlueprintCallable, Category="Attacker")
 	virtual void CheckCombo() = 0;
@@ -5,20 +5,67 @@
 #include "StateTreeExecutionContext.h"
 #include "StateTreeExecutionTypes.h"
 #include "AIController.h"
-#include "Kismet/GameplayStatics.h"
+#include "Engine/World.h"
+#include "PlayerPerceptionSubsystem.h"
+
+namespace
+{
+	/** Returns the player perception subsystem of the NPC's world */
+	UPlayerPerceptionSubsystem* GetPerception(const FStateTreeGetPlayerInstanceData& InstanceData)
+	{
+		UWorld* World = InstanceData.Controller ? InstanceData.Controller->GetWorld() : nullptr;
+		return World ? World->GetSubsystem<UPlayerPerceptionSubsystem>() : nullptr;
+	}
+}
+
+EStateTreeRunStatus FStateTreeGetPlayerTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+	// get the instance data
+	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+	// have the perception subsystem measure our distance to the players in its per-frame batch
+	if (InstanceData.ObserverHandle == INDEX_NONE)
+	{
+		if (UPlayerPerceptionSubsystem* Perception = GetPerception(InstanceData))
+		{
+			InstanceData.ObserverHandle = Perception->RegisterObserver(InstanceData.NPC);
+		}
+	}
+
+	return EStateTreeRunStatus::Running;
+}
+
+void FStateTreeGetPlayerTask::ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+	// get the instance data
+	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+	// stop measuring while the state is inactive
+	if (UPlayerPerceptionSubsystem* Perception = GetPerception(InstanceData))
+	{
+		Perception->UnregisterObserver(InstanceData.ObserverHandle);
+	}
+
+	InstanceData.ObserverHandle = INDEX_NONE;
+}
 
 EStateTreeRunStatus FStateTreeGetPlayerTask::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
 {
 	// get the instance data
 	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
 
-	// set the player pawn as the target
-	InstanceData.TargetPlayer = UGameplayStatics::GetPlayerPawn(InstanceData.Controller.Get(), 0);
+	// set the nearest player pawn as the target, read from this frame's shared perception snapshot
+	UPlayerPerceptionSubsystem* Perception = GetPerception(InstanceData);
+
+	float Distance = 0.0f;
+	const FPerceivedPlayer* Player = Perception ? Perception->GetNearestPlayer(InstanceData.ObserverHandle, Distance) : nullptr;
+
+	InstanceData.TargetPlayer = Player ? Player->Pawn.Get() : nullptr;
 
 	// are the NPC and target valid?
 	if (IsValid(InstanceData.TargetPlayer) && IsValid(InstanceData.NPC))
 	{
-		InstanceData.bValidTarget = FVector::Distance(InstanceData.NPC->GetActorLocation(), InstanceData.TargetPlayer->GetActorLocation()) < InstanceData.RangeMax;
+		InstanceData.bValidTarget = Distance < InstanceData.RangeMax;
 	}
 
 	return EStateTreeRunStatus::Running;
@@ -11,5 +11,6 @@ public class SwingGameEditorTarget : TargetRules
 		DefaultBuildSettings = BuildSettingsVersion.V6;
 		IncludeOrderVersion = EngineIncludeOrderVersion.Unreal5_7;
 		ExtraModuleNames.Add("SwingGame");
+		ExtraModuleNames.Add("SwingGameEditor");
 	}
 }
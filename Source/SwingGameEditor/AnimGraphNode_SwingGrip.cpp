@@ -0,0 +1,21 @@
+#include "AnimGraphNode_SwingGrip.h"
+
+#define LOCTEXT_NAMESPACE "SwingGameEditor"
+
+FText UAnimGraphNode_SwingGrip::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+    return GetControllerDescription();
+}
+
+FText UAnimGraphNode_SwingGrip::GetTooltipText() const
+{
+    return LOCTEXT("SwingGripTooltip",
+        "Solves every gripping limb onto the swing pivot in one pass. Bind Snapshot and Alpha to the swing anim instance.");
+}
+
+FText UAnimGraphNode_SwingGrip::GetControllerDescription() const
+{
+    return LOCTEXT("SwingGrip", "Swing Grip");
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AnimGraphNode_SkeletalControlBase.h"
+#include "AnimNode_SwingGrip.h"
+#include "AnimGraphNode_SwingGrip.generated.h"
+
+/** Anim graph node for FAnimNode_SwingGrip */
+UCLASS()
+class SWINGGAMEEDITOR_API UAnimGraphNode_SwingGrip : public UAnimGraphNode_SkeletalControlBase
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(EditAnywhere, Category = "Settings")
+    FAnimNode_SwingGrip Node;
+
+    virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+    virtual FText GetTooltipText() const override;
+
+protected:
+    virtual FText GetControllerDescription() const override;
+    virtual const FAnimNode_SkeletalControlBase* GetNode() const override { return &Node; }
+};
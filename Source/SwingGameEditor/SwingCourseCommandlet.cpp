@@ -0,0 +1,146 @@
+#include "SwingCourseCommandlet.h"
+#include "SwingCourseGenerator.h"
+#include "SwingPole.h"
+#include "SwingPoleGraph.h"
+#include "GameFramework/Character.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSwingCourseCommandlet, Log, All);
+
+namespace
+{
+    bool SaveCourseLevel(
+        const FSwingCourse& Course, const FString& Path, TSubclassOf<ASwingPole> PoleClass,
+        TSubclassOf<ACharacter> SwingerClass, const FSwingReachTuning& Tuning)
+    {
+        const FString PackageName = FString::Printf(TEXT("%s/SwingCourse_%d"), *Path, Course.Seed);
+
+        UPackage* Package = CreatePackage(*PackageName);
+        UWorld*   World   = UWorld::CreateWorld(
+            EWorldType::Inactive, false, FPackageName::GetShortFName(PackageName), Package);
+        if (!World) return false;
+
+        World->SetFlags(RF_Public | RF_Standalone);
+        Package->SetPackageFlags(PKG_ContainsMap);
+
+        for (const FSwingCoursePole& CoursePole : Course.Poles)
+        {
+            if (ASwingPole* Pole = World->SpawnActor<ASwingPole>(PoleClass, FTransform(CoursePole.Center)))
+                Pole->PoleHalfLength = CoursePole.HalfLength;
+        }
+
+        // Bake from the placed poles, so the graph sees the pole class's real reach
+        if (ASwingPoleGraph* Graph = World->SpawnActor<ASwingPoleGraph>())
+        {
+            Graph->SwingerClass = SwingerClass;
+            Graph->Tuning       = Tuning;
+            Graph->Bake();
+        }
+
+        const FString Filename = FPackageName::LongPackageNameToFilename(
+            PackageName, FPackageName::GetMapPackageExtension());
+
+        FSavePackageArgs SaveArgs;
+        SaveArgs.TopLevelFlags = RF_Standalone;
+        const bool bSaved = UPackage::SavePackage(Package, World, *Filename, SaveArgs);
+
+        World->DestroyWorld(false);
+        World->RemoveFromRoot();
+        return bSaved;
+    }
+}
+
+USwingCourseCommandlet::USwingCourseCommandlet()
+{
+    IsClient     = false;
+    IsEditor     = true;
+    IsServer     = false;
+    LogToConsole = true;
+}
+
+int32 USwingCourseCommandlet::Main(const FString& Params)
+{
+    int32 Count      = 10;
+    int32 Candidates = 10000;
+    int32 FirstSeed  = 0;
+    FString Path     = TEXT("/Game/Generated/SwingCourses");
+    FParse::Value(*Params, TEXT("Count="), Count);
+    FParse::Value(*Params, TEXT("Candidates="), Candidates);
+    FParse::Value(*Params, TEXT("Seed="), FirstSeed);
+    FParse::Value(*Params, TEXT("Path="), Path);
+    const bool bValidateOnly = FParse::Param(*Params, TEXT("ValidateOnly"));
+
+    FSwingCourseSettings Settings;
+    FParse::Value(*Params, TEXT("Poles="), Settings.NumPoles);
+
+    TSubclassOf<ASwingPole> PoleClass = ASwingPole::StaticClass();
+    FString PoleClassPath;
+    if (FParse::Value(*Params, TEXT("PoleClass="), PoleClassPath))
+    {
+        PoleClass = LoadClass<ASwingPole>(nullptr, *PoleClassPath);
+        if (!PoleClass)
+        {
+            UE_LOG(LogSwingCourseCommandlet, Error, TEXT("Could not load pole class %s"), *PoleClassPath);
+            return 1;
+        }
+    }
+
+    // Validate against the reach the placed poles will actually have
+    if (const ASwingPole* PoleDefaults = PoleClass->GetDefaultObject<ASwingPole>())
+        Settings.PoleReach = PoleDefaults->GetSegment().Reach;
+
+    FSwingReachTuning Tuning;
+    TSubclassOf<ACharacter> SwingerClass;
+    FString SwingerPath;
+    if (FParse::Value(*Params, TEXT("Swinger="), SwingerPath))
+    {
+        SwingerClass = LoadClass<ACharacter>(nullptr, *SwingerPath);
+        if (!Tuning.CopyFromSwinger(SwingerClass))
+        {
+            UE_LOG(LogSwingCourseCommandlet, Error, TEXT("%s has no SwingComponent"), *SwingerPath);
+            return 1;
+        }
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    TArray<FSwingCourse> Accepted;
+    FSwingCourseGenerator::GenerateBatch(Settings, Tuning, FirstSeed, Candidates, Accepted);
+
+    const double Seconds = FPlatformTime::Seconds() - StartTime;
+    UE_LOG(LogSwingCourseCommandlet, Display,
+        TEXT("Validated %d candidate courses of %d poles in %.1f ms (%.0f courses/s): %d accepted"),
+        Candidates, Settings.NumPoles, Seconds * 1000.0, Candidates / FMath::Max(Seconds, 1e-6),
+        Accepted.Num());
+
+    if (bValidateOnly) return 0;
+
+    if (Accepted.IsEmpty())
+    {
+        UE_LOG(LogSwingCourseCommandlet, Error, TEXT("No course passed validation — widen the settings or raise -Candidates"));
+        return 1;
+    }
+
+    int32 Failures = 0;
+    for (int32 Index = 0; Index < FMath::Min(Count, Accepted.Num()); ++Index)
+    {
+        const FSwingCourse& Course = Accepted[Index];
+        if (SaveCourseLevel(Course, Path, PoleClass, SwingerClass, Tuning))
+        {
+            UE_LOG(LogSwingCourseCommandlet, Display,
+                TEXT("Saved course %d: %.1f s of flight, narrowest release window %.2f rad"),
+                Course.Seed, Course.TotalFlightTime, Course.NarrowestWindow);
+        }
+        else
+        {
+            UE_LOG(LogSwingCourseCommandlet, Error, TEXT("Could not save course %d"), Course.Seed);
+            ++Failures;
+        }
+    }
+
+    return Failures == 0 ? 0 : 1;
+}
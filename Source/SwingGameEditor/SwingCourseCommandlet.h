@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "SwingCourseCommandlet.generated.h"
+
+/**
+ * Generates swing courses, validates them analytically and saves the accepted ones
+ * as levels holding the poles and a baked ASwingPoleGraph.
+ * Usage: UnrealEditor-Cmd SwingGame.uproject -run=SwingCourse -Count=10 -Candidates=20000
+ *        [-Seed=0] [-Poles=12] [-Path=/Game/Generated/SwingCourses]
+ *        [-PoleClass=/Game/.../BP_SwingPole.BP_SwingPole_C] [-Swinger=/Game/.../BP_Character.BP_Character_C]
+ *        [-ValidateOnly] -unattended -nullrhi
+ */
+UCLASS()
+class SWINGGAMEEDITOR_API USwingCourseCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    USwingCourseCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,24 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class SwingGameEditor : ModuleRules
+{
+	public SwingGameEditor(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(new string[] {
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"SwingGame"
+		});
+
+		PrivateDependencyModuleNames.AddRange(new string[] {
+			"AnimGraph",
+			"AnimGraphRuntime",
+			"BlueprintGraph"
+		});
+	}
+}
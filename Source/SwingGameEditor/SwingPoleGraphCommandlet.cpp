@@ -0,0 +1,73 @@
+#include "SwingPoleGraphCommandlet.h"
+#include "SwingPoleGraph.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSwingPoleGraphCommandlet, Log, All);
+
+USwingPoleGraphCommandlet::USwingPoleGraphCommandlet()
+{
+    IsClient     = false;
+    IsEditor     = true;
+    IsServer     = false;
+    LogToConsole = true;
+}
+
+int32 USwingPoleGraphCommandlet::Main(const FString& Params)
+{
+    FString MapList;
+    if (!FParse::Value(*Params, TEXT("Maps="), MapList))
+    {
+        UE_LOG(LogSwingPoleGraphCommandlet, Error, TEXT("Usage: -run=SwingPoleGraph -Maps=/Game/Maps/A+/Game/Maps/B"));
+        return 1;
+    }
+
+    TArray<FString> Maps;
+    MapList.ParseIntoArray(Maps, TEXT("+"));
+
+    int32 Failures = 0;
+    for (const FString& Map : Maps)
+    {
+        UPackage* Package = LoadPackage(nullptr, *Map, LOAD_None);
+        UWorld*   World   = Package ? UWorld::FindWorldInPackage(Package) : nullptr;
+        if (!World || !World->PersistentLevel)
+        {
+            UE_LOG(LogSwingPoleGraphCommandlet, Error, TEXT("Could not load map %s"), *Map);
+            ++Failures;
+            continue;
+        }
+
+        // Graphs are placed by hand — the commandlet only refreshes them
+        int32 NumGraphs = 0;
+        for (AActor* Actor : World->PersistentLevel->Actors)
+        {
+            if (ASwingPoleGraph* Graph = Cast<ASwingPoleGraph>(Actor))
+            {
+                Graph->Bake();
+                ++NumGraphs;
+            }
+        }
+
+        if (NumGraphs == 0)
+        {
+            UE_LOG(LogSwingPoleGraphCommandlet, Warning, TEXT("%s has no ASwingPoleGraph, skipped"), *Map);
+            continue;
+        }
+
+        const FString Filename = FPackageName::LongPackageNameToFilename(
+            Package->GetName(), FPackageName::GetMapPackageExtension());
+
+        FSavePackageArgs SaveArgs;
+        SaveArgs.TopLevelFlags = RF_Standalone;
+        if (!UPackage::SavePackage(Package, World, *Filename, SaveArgs))
+        {
+            UE_LOG(LogSwingPoleGraphCommandlet, Error, TEXT("Could not save %s"), *Filename);
+            ++Failures;
+        }
+    }
+
+    return Failures == 0 ? 0 : 1;
+}
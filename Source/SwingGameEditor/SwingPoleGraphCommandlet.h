@@ -0,0 +1,20 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "SwingPoleGraphCommandlet.generated.h"
+
+/**
+ * Re-bakes every ASwingPoleGraph in the given maps and saves them.
+ * Usage: UnrealEditor-Cmd SwingGame.uproject -run=SwingPoleGraph -Maps=/Game/Maps/A+/Game/Maps/B
+ */
+UCLASS()
+class SWINGGAMEEDITOR_API USwingPoleGraphCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    USwingPoleGraphCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};